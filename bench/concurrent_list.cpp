@@ -0,0 +1,74 @@
+/**
+* @file concurrent_list.cpp
+* @brief throughput of `Concurrent_list_` against a mutex guarded `List_` by thread count,
+*   `tests/concurrent_list.cpp` checks that no element is lost or duplicated
+*
+*   g++ -std=c++20 -O2 -pthread -I lib bench/concurrent_list.cpp -o concurrent_list
+*   ./concurrent_list [max threads] [ops per thread]
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "concurrent_list.hpp"
+#include "list.hpp"
+
+
+namespace {
+
+/// @brief ops/s of `threads` threads each cycling push_back, push_front, pop_front
+template <typename Push_back, typename Push_front, typename Pop>
+auto throughput(const unsigned threads, const int ops, Push_back push_back, Push_front push_front, Pop pop)
+    -> double
+{
+  std::atomic<bool> go = {false};
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < threads; ++t) {
+    pool.emplace_back([&] {
+      while ( !go.load() ) { std::this_thread::yield(); }
+      for (int i = 0; i < ops; ++i) {
+        switch ( i % 3 ) {
+          case 0:  push_back(i);  break;
+          case 1:  push_front(i); break;
+          default: pop();         break;
+        }
+      }
+    });
+  }
+  const auto start = std::chrono::steady_clock::now();
+  go = true;
+  for (auto& t : pool) { t.join(); }
+  const std::chrono::duration<double> took = std::chrono::steady_clock::now() - start;
+  return threads * static_cast<double>(ops) / took.count();
+}
+
+} // namespace
+
+auto main(int argc, char **argv)
+    -> int
+{
+  const unsigned max_threads  = argc > 1 ? static_cast<unsigned>(std::atoi(argv[1])) : 16;
+  const int      ops          = argc > 2 ? std::atoi(argv[2]) : 300'000;
+  //
+  std::puts("threads  concurrent Mops/s  mutex+List_ Mops/s");
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+    Concurrent_list_<int> lock_free;
+    const double a = throughput(threads, ops,
+      [&](int v) { lock_free.push_back(v); },
+      [&](int v) { lock_free.push_front(v); },
+      [&] { (void)lock_free.try_pop_front(); });
+    //
+    List_<int> locked;
+    std::mutex mutex;
+    const double b = throughput(threads, ops,
+      [&](int v) { const std::lock_guard lock(mutex); locked.push_back(v); },
+      [&](int v) { const std::lock_guard lock(mutex); locked.push_front(v); },
+      [&] { const std::lock_guard lock(mutex); if ( !locked.is_empty() ) { locked.pop_front(); } });
+    std::printf("%7u  %18.2f  %18.2f\n", threads, a / 1e6, b / 1e6);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,393 @@
+/**
+* @file containers.cpp
+* @brief `List_` and `Index_list_` against `std::list`, `std::deque` and `std::vector`: push/pop
+*   at both ends, positional insert in the middle, iteration, search/locate, sort, split + merge,
+*   copy, construction from a vector and destruction, for sizes 10 .. 10^7 and elements `int`, a 64 byte POD and `std::string`,
+*   the lists also walk after a sort scattered their nodes, and `Index_list_` once more after
+*   `compact()`, results go out as JSON so runs of different releases can be diffed
+*
+*   cmake -S . -B build && cmake --build build --target bench_containers
+*   ./build/bench/bench_containers [--max-size N] [--min-time-ms M] [--filter text] [--out file.json]
+*
+*   every record is the mean time of one run of `op` on a container of `size` elements,
+*   `ns_per_element` divides it by the elements the op touched; quadratic combinations
+*   ( `std::vector` push_front ) are left out above 10^5 elements, `Index_list_` has no split + merge
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "index_list.hpp"
+#include "list.hpp"
+
+
+namespace {
+
+/// @brief 64 byte trivially copyable element ordered by its key
+struct Pod64 {
+  std::int64_t m_key      = {};
+  std::int64_t m_pad[7]   = {};
+  //
+  friend constexpr auto operator==(const Pod64& a, const Pod64& b) noexcept -> bool { return a.m_key == b.m_key; }
+  friend constexpr auto operator<=>(const Pod64& a, const Pod64& b) noexcept { return a.m_key <=> b.m_key; }
+}; // end of struct Pod64
+static_assert(sizeof(Pod64) == 64 && std::is_trivially_copyable_v<Pod64>);
+
+/// @brief spreads `i` over the 64 bit range so sort inputs are not presorted
+constexpr auto scramble(std::uint64_t i)
+    noexcept -> std::uint64_t
+{
+  i ^= i >> 33; i *= 0xff51afd7ed558ccdULL;
+  i ^= i >> 33; i *= 0xc4ceb3f99a2a1b53ULL;
+  return i ^ (i >> 33);
+}
+
+template <typename T>
+auto make_value(const std::uint64_t i)
+    -> T
+{
+  if constexpr ( std::is_same_v<T, int> ) {
+    return static_cast<int>(i & 0x7fffffff);
+  } else if constexpr ( std::is_same_v<T, Pod64> ) {
+    Pod64 v;
+    v.m_key = static_cast<std::int64_t>(i);
+    return v;
+  } else {
+    // long enough to live on the heap, like most real keys
+    char buf[32];
+    std::snprintf(buf, sizeof buf, "key-%020llu", static_cast<unsigned long long>(i));
+    return std::string(buf);
+  }
+}
+
+template <typename T> constexpr std::string_view type_name = "string";
+template <> constexpr std::string_view type_name<int>   = "int";
+template <> constexpr std::string_view type_name<Pod64> = "pod64";
+
+/// @brief keeps the compiler from dropping a result nobody reads
+template <typename T>
+auto keep(const T& value)
+    -> void
+{
+  asm volatile("" : : "r"(&value) : "memory");
+}
+
+/*
+* the five containers behind one set of free functions, the `List_` and `Index_list_` columns
+* use the lists' own api
+*/
+template <typename C> constexpr bool is_vector = false;
+template <typename T> constexpr bool is_vector<std::vector<T>> = true;
+template <typename C> constexpr bool is_list_  = false;
+template <typename T> constexpr bool is_list_<List_<T>> = true;
+template <typename T> constexpr bool is_list_<Index_list_<T>> = true;
+template <typename C> constexpr bool is_index_list = false;
+template <typename T> constexpr bool is_index_list<Index_list_<T>> = true;
+template <typename C> constexpr bool is_stdlist = false;
+template <typename T> constexpr bool is_stdlist<std::list<T>> = true;
+
+template <typename C> constexpr std::string_view container_name = "std::deque";
+template <typename T> constexpr std::string_view container_name<List_<T>>       = "List_";
+template <typename T> constexpr std::string_view container_name<Index_list_<T>> = "Index_list_";
+template <typename T> constexpr std::string_view container_name<std::list<T>>   = "std::list";
+template <typename T> constexpr std::string_view container_name<std::vector<T>> = "std::vector";
+
+template <typename C>
+auto push_front(C& c, typename C::value_type&& v)
+    -> void
+{
+  if constexpr ( is_vector<C> ) { c.insert(c.begin(), std::move(v)); }
+  else                          { c.push_front(std::move(v)); }
+}
+
+/// @brief inserts before the element at `pos`, `pos < size`
+template <typename C>
+auto insert_at(C& c, const std::size_t pos, typename C::value_type&& v)
+    -> void
+{
+  if constexpr ( is_list_<C> ) { c.push_at(pos, std::move(v)); }
+  else                         { c.insert(std::next(c.begin(), static_cast<std::ptrdiff_t>(pos)), std::move(v)); }
+}
+
+template <typename C>
+auto pop_front(C& c)
+    -> void
+{
+  if constexpr ( is_vector<C> ) { c.erase(c.begin()); }
+  else                          { c.pop_front(); }
+}
+
+template <typename C>
+auto contains(const C& c, const typename C::value_type& v)
+    -> bool
+{
+  if constexpr ( is_list_<C> )  { return c.search(v); }
+  else                          { return std::find(c.begin(), c.end(), v) != c.end(); }
+}
+
+template <typename C>
+auto index_of(const C& c, const typename C::value_type& v)
+    -> std::int64_t
+{
+  if constexpr ( is_list_<C> ) { return c.locate(v); }
+  else {
+    const auto it = std::find(c.begin(), c.end(), v);
+    return it == c.end() ? -1 : static_cast<std::int64_t>(std::distance(c.begin(), it));
+  }
+}
+
+template <typename C>
+auto sort(C& c)
+    -> void
+{
+  if constexpr ( is_list_<C> || is_stdlist<C> ) { c.sort(); }
+  else                                          { std::sort(c.begin(), c.end()); }
+}
+
+/// @brief cuts the back half off into a second container and appends it again
+template <typename C>
+auto split_merge(C& c)
+    -> void
+{
+  const auto middle = std::next(c.begin(), static_cast<std::ptrdiff_t>(c.size() / 2));
+  if constexpr ( is_list_<C> ) {
+    C back = c.split_at(middle);
+    c.concat(std::move(back));
+  } else if constexpr ( is_stdlist<C> ) {
+    C back;
+    back.splice(back.end(), c, middle, c.end());
+    c.splice(c.end(), back);
+  } else {
+    C back(std::make_move_iterator(middle), std::make_move_iterator(c.end()));
+    c.erase(middle, c.end());
+    c.insert(c.end(), std::make_move_iterator(back.begin()), std::make_move_iterator(back.end()));
+  }
+}
+
+template <typename C>
+auto filled(const std::size_t n, const bool scrambled = false)
+    -> C
+{
+  using T = typename C::value_type;
+  C c;
+  for (std::size_t i = 0; i < n; ++i) { c.push_back(make_value<T>(scrambled ? scramble(i) : i)); }
+  return c;
+}
+
+struct Options {
+  std::size_t       m_max_size  = 10'000'000;
+  double            m_min_time  = 0.005; // seconds spent in the timed part per record, at least one run
+  std::string_view  m_filter    = {};
+  const char       *m_out       = nullptr;
+}; // end of struct Options
+
+class Suite
+{
+  const Options&  m_options;
+  std::FILE      *m_out;
+  bool            m_first = {true};
+
+  /**
+  * @brief runs `prepare()` then times `op(state)` until the timed part adds up to the minimum time
+  * @return mean seconds per run
+  */
+  template <typename Prepare, typename Op>
+  auto measure(Prepare prepare, Op op) const
+      -> double
+  {
+    using clock = std::chrono::steady_clock;
+    double      total = 0;
+    std::size_t runs  = 0;
+    do {
+      auto state        = prepare();
+      const auto start  = clock::now();
+      op(state);
+      const std::chrono::duration<double> took = clock::now() - start;
+      keep(state);
+      total += took.count();
+      ++runs;
+    } while ( total < m_options.m_min_time );
+    return total / static_cast<double>(runs);
+  }
+
+  auto emit(std::string_view container, std::string_view type, std::string_view op,
+            const std::size_t size, const std::size_t touched, const double seconds)
+      -> void
+  {
+    std::fprintf(m_out, "%s\n    {\"container\": \"%.*s\", \"type\": \"%.*s\", \"op\": \"%.*s\", "
+                        "\"size\": %zu, \"ns\": %.1f, \"ns_per_element\": %.3f}",
+                 m_first ? "" : ",",
+                 static_cast<int>(container.size()), container.data(),
+                 static_cast<int>(type.size()), type.data(),
+                 static_cast<int>(op.size()), op.data(),
+                 size, seconds * 1e9, seconds * 1e9 / static_cast<double>(std::max<std::size_t>(touched, 1)));
+    std::fflush(m_out);
+    m_first = false;
+  }
+
+  /// @brief false when `--filter` rules the record out
+  [[nodiscard]] auto wanted(std::string_view container, std::string_view type, std::string_view op) const
+      -> bool
+  {
+    if ( m_options.m_filter.empty() ) { return true; }
+    std::string key;
+    key.append(container).append("/").append(type).append("/").append(op);
+    return key.find(m_options.m_filter) != std::string::npos;
+  }
+
+  template <typename C, typename Prepare, typename Op>
+  auto record(std::string_view op, const std::size_t size, const std::size_t touched, Prepare prepare, Op fn)
+      -> void
+  {
+    using T = typename C::value_type;
+    if ( !wanted(container_name<C>, type_name<T>, op) ) { return; }
+    std::fprintf(stderr, "%-12.*s %-7.*s %-13.*s %zu\n",
+                 static_cast<int>(container_name<C>.size()), container_name<C>.data(),
+                 static_cast<int>(type_name<T>.size()), type_name<T>.data(),
+                 static_cast<int>(op.size()), op.data(), size);
+    emit(container_name<C>, type_name<T>, op, size, touched, measure(prepare, fn));
+  }
+
+public:
+
+  Suite(const Options& options, std::FILE *out)
+    : m_options(options), m_out(out) {}
+
+  template <typename C>
+  auto run(const std::size_t n)
+      -> void
+  {
+    using T = typename C::value_type;
+    const auto empty    = [] { return C{}; };
+    const auto full     = [n] { return filled<C>(n); };
+    const auto shuffled = [n] { return filled<C>(n, true); };
+    const std::size_t inserts = std::min<std::size_t>(n, 100);
+    //
+    record<C>("push_back", n, n, empty, [n](C& c) {
+      for (std::size_t i = 0; i < n; ++i) { c.push_back(make_value<T>(i)); }
+    });
+    if ( !is_vector<C> || n <= 100'000 ) {
+      record<C>("push_front", n, n, empty, [n](C& c) {
+        for (std::size_t i = 0; i < n; ++i) { push_front(c, make_value<T>(i)); }
+      });
+    }
+    record<C>("insert_middle", n, inserts, full, [inserts](C& c) {
+      for (std::size_t i = 0; i < inserts; ++i) { insert_at(c, c.size() / 2, make_value<T>(i)); }
+    });
+    record<C>("pop_back", n, n, full, [n](C& c) {
+      for (std::size_t i = 0; i < n; ++i) { c.pop_back(); }
+    });
+    if ( !is_vector<C> || n <= 100'000 ) {
+      record<C>("pop_front", n, n, full, [n](C& c) {
+        for (std::size_t i = 0; i < n; ++i) { pop_front(c); }
+      });
+    }
+    const C      kept   = filled<C>(n);
+    const auto   borrow = [&kept] { return &kept; };
+    record<C>("iterate", n, n, borrow, [](const C *c) {
+      std::size_t sum = 0;
+      for (const auto& v : *c) { sum += sizeof(v); keep(v); }
+      keep(sum);
+    });
+    const T last = make_value<T>(n - 1);
+    record<C>("search", n, n, borrow, [&last](const C *c) { keep(contains(*c, last)); });
+    record<C>("locate", n, n, borrow, [&last](const C *c) { keep(index_of(*c, last)); });
+    record<C>("copy", n, n, borrow, [](const C *c) { C copy(*c); keep(copy); });
+    if constexpr ( !is_index_list<C> ) {
+      const std::vector<T> source = filled<std::vector<T>>(n);
+      record<C>("from_vector", n, n, [&source] { return &source; },
+                [](const std::vector<T> *v) { C c(v->begin(), v->end()); keep(c); });
+    }
+    record<C>("sort", n, n, shuffled, [](C& c) { sort(c); });
+    if constexpr ( !is_index_list<C> ) {
+      record<C>("split_merge", n, n, full, [](C& c) { split_merge(c); });
+    }
+    record<C>("destroy", n, n, [n] { return std::optional<C>(filled<C>(n)); },
+              [](std::optional<C>& c) { c.reset(); });
+    if constexpr ( is_list_<C> || is_stdlist<C> ) {
+      // sorting relinks, so traversal order no longer follows the order the nodes were made in
+      const auto sorted    = [n] { C c = filled<C>(n, true); sort(c); return c; };
+      C          scattered = sorted();
+      const T    tail      = scattered.back();
+      const auto walk      = [&scattered] { return &std::as_const(scattered); };
+      const auto iterate   = [](const C *c) {
+        std::size_t sum = 0;
+        for (const auto& v : *c) { sum += sizeof(v); keep(v); }
+        keep(sum);
+      };
+      const auto find_tail = [&tail](const C *c) { keep(contains(*c, tail)); };
+      record<C>("iterate_scattered", n, n, walk, iterate);
+      record<C>("search_scattered", n, n, walk, find_tail);
+      if constexpr ( is_index_list<C> ) {
+        record<C>("compact", n, n, sorted, [](C& c) { c.compact(); });
+        scattered.compact();
+        record<C>("iterate_compacted", n, n, walk, iterate);
+        record<C>("search_compacted", n, n, walk, find_tail);
+      }
+    }
+  }
+
+  template <typename T>
+  auto run_type(const std::size_t n)
+      -> void
+  {
+    run<List_<T>>(n);
+    run<Index_list_<T>>(n);
+    run<std::list<T>>(n);
+    run<std::deque<T>>(n);
+    run<std::vector<T>>(n);
+  }
+}; // end of class Suite
+
+auto parse(const int argc, char **argv, Options& options)
+    -> bool
+{
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if ( i + 1 == argc ) { return false; }
+    const char *value = argv[++i];
+    if      ( arg == "--max-size" )    { options.m_max_size = std::strtoull(value, nullptr, 10); }
+    else if ( arg == "--min-time-ms" ) { options.m_min_time = std::strtod(value, nullptr) / 1e3; }
+    else if ( arg == "--filter" )      { options.m_filter   = value; }
+    else if ( arg == "--out" )         { options.m_out      = value; }
+    else                               { return false; }
+  }
+  return true;
+}
+
+} // namespace
+
+auto main(int argc, char **argv)
+    -> int
+{
+  Options options;
+  if ( !parse(argc, argv, options) ) {
+    std::fprintf(stderr, "usage: %s [--max-size N] [--min-time-ms M] [--filter text] [--out file.json]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  std::FILE *out = options.m_out != nullptr ? std::fopen(options.m_out, "w") : stdout;
+  if ( out == nullptr ) { std::perror(options.m_out); return EXIT_FAILURE; }
+  //
+  std::fprintf(out, "{\n  \"benchmark\": \"containers\",\n  \"compiler\": \"%s\",\n  \"min_time_ms\": %.3f,\n  \"results\": [",
+               __VERSION__, options.m_min_time * 1e3);
+  Suite suite(options, out);
+  for (std::size_t n = 10; n <= options.m_max_size; n *= 10) {
+    suite.run_type<int>(n);
+    suite.run_type<Pod64>(n);
+    suite.run_type<std::string>(n);
+  }
+  std::fprintf(out, "\n  ]\n}\n");
+  if ( out != stdout ) { std::fclose(out); }
+  return EXIT_SUCCESS;
+}
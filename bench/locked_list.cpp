@@ -0,0 +1,101 @@
+/**
+* @file locked_list.cpp
+* @brief mixed readers and writers on `Locked_list_` against a `List_` behind a `std::shared_mutex`,
+*   writers insert around and remove their own values at random spots of a prefilled list,
+*   the program fails if the list does not come back to its prefilled contents
+*
+*   g++ -std=c++20 -O2 -pthread -I lib bench/locked_list.cpp -o locked_list
+*   ./locked_list [max threads] [ops per thread] [list size]
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include "list.hpp"
+#include "locked_list.hpp"
+
+
+namespace {
+
+/**
+* @brief runs `threads` threads, every fourth one a writer, for `ops` operations each
+* @return ops/s over all threads
+*/
+template <typename Write, typename Read>
+auto run(const unsigned threads, const int ops, Write write, Read read)
+    -> double
+{
+  std::atomic<bool> go = {false};
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < threads; ++t) {
+    pool.emplace_back([&, t] {
+      std::mt19937 rng(t);
+      while ( !go.load() ) { std::this_thread::yield(); }
+      for (int i = 0; i < ops; ++i) {
+        if ( t % 4 == 0 ) { write(rng, t, i); }
+        else              { read(rng); }
+      }
+    });
+  }
+  const auto start = std::chrono::steady_clock::now();
+  go = true;
+  for (auto& t : pool) { t.join(); }
+  const std::chrono::duration<double> took = std::chrono::steady_clock::now() - start;
+  return threads * static_cast<double>(ops) / took.count();
+}
+
+} // namespace
+
+auto main(int argc, char **argv)
+    -> int
+{
+  const unsigned max_threads  = argc > 1 ? static_cast<unsigned>(std::atoi(argv[1])) : 16;
+  const int      ops          = argc > 2 ? std::atoi(argv[2]) : 2'000;
+  const int      keys         = argc > 3 ? std::atoi(argv[3]) : 2'000;
+  // written values never collide with the prefilled keys
+  const auto fresh = [&](const unsigned t, const int i) { return keys + static_cast<int>(t) * ops + i; };
+  //
+  std::puts("threads  locked_list_ Kops/s  shared_mutex+List_ Kops/s");
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+    Locked_list_<int> fine;
+    for (int k = 0; k < keys; ++k) { fine.push_back(k); }
+    const double a = run(threads, ops,
+      [&](std::mt19937& rng, const unsigned t, const int i) {
+        const int key = static_cast<int>(rng() % static_cast<unsigned>(keys));
+        if ( i % 2 == 0 ) { fine.push_after_value(key, fresh(t, i)); }
+        else              { fine.push_before_value(key, fresh(t, i)); }
+        fine.pop_value(fresh(t, i));
+      },
+      [&](std::mt19937& rng) { (void)fine.search(static_cast<int>(rng() % static_cast<unsigned>(keys))); });
+    //
+    std::vector<int> left;
+    fine.for_each([&](const int v) { left.push_back(v); });
+    bool intact = left.size() == static_cast<std::size_t>(keys) && fine.size() == left.size();
+    for (int k = 0; intact && k < keys; ++k) { intact = left[static_cast<std::size_t>(k)] == k; }
+    if ( !intact ) { std::printf("%u threads: Locked_list_ lost its contents\n", threads); return EXIT_FAILURE; }
+    //
+    List_<int> coarse;
+    for (int k = 0; k < keys; ++k) { coarse.push_back(k); }
+    std::shared_mutex mutex;
+    const double b = run(threads, ops,
+      [&](std::mt19937& rng, const unsigned t, const int i) {
+        const int key = static_cast<int>(rng() % static_cast<unsigned>(keys));
+        const std::unique_lock lock(mutex);
+        if ( i % 2 == 0 ) { coarse.push_after_value(key, fresh(t, i)); }
+        else              { coarse.push_before_value(key, fresh(t, i)); }
+        coarse.pop_value(fresh(t, i));
+      },
+      [&](std::mt19937& rng) {
+        const std::shared_lock lock(mutex);
+        (void)coarse.search(static_cast<int>(rng() % static_cast<unsigned>(keys)));
+      });
+    std::printf("%7u  %19.1f  %25.1f\n", threads, a / 1e3, b / 1e3);
+  }
+  return EXIT_SUCCESS;
+}
@@ -1,40 +1,131 @@
 #ifndef APOLOGY_HPP
 #define APOLOGY_HPP
 
-#include <unordered_map>
-#include <string_view>
 #include <cassert>
-#include <iostream>
+#include <concepts>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 
 
 enum class Apology {
   empty = 1,
   not_found = 2,
   invalid_position = 3,
+  full = 4,
 };
 
-inline
-const std::unordered_map<Apology, std::string_view>
-  Apologies =
+/// @brief the text `show` prints for `apology`
+constexpr
+auto message(const Apology apology)
+    noexcept -> std::string_view
 {
-  { Apology::empty, "- Apology: List is empty...\n" },
-  { Apology::not_found, "- Apology: Node not found...\n" },
-  { Apology::invalid_position, " -Apology: Invalid position...\n"}
-};
+  switch ( apology ) {
+    case Apology::empty:            return "- Apology: List is empty...\n";
+    case Apology::not_found:        return "- Apology: Node not found...\n";
+    case Apology::invalid_position: return " -Apology: Invalid position...\n";
+    case Apology::full:             return "- Apology: List is full...\n";
+  }
+  return "- Apology: ...\n";
+}
 
 inline
-auto get_apology(const Apology& apology)
+auto show(const Apology& apology)
     -> void
 {
-  if ( apology == Apology::empty ) {
-    std::cerr << Apologies.at( Apology::empty );
-    assert(false);
-  } else if (apology == Apology::invalid_position) {
-    std::cerr << Apologies.at( Apology::invalid_position );
-    assert(false);
-  }
-  std::cerr << Apologies.at( Apology::not_found );
+  std::fputs(message( apology ).data(), stderr);
   assert(false);
 }
 
+/// @brief thrown by containers using `policy::Throw`
+class Apology_error : public std::logic_error
+{
+  Apology m_apology;
+
+public:
+  explicit Apology_error(const Apology apology)
+    : std::logic_error(std::string(message(apology))), m_apology(apology) {}
+
+  [[nodiscard]] auto apology()
+      const noexcept -> Apology
+  {
+    return m_apology;
+  }
+}; // end of class Apology_error
+
+/**
+* @brief what a container does when an operation cannot go on ( empty list, bad position, ... ),
+*   picked at compile time by the `Policy` template parameter
+*/
+namespace policy {
+  /// @brief prints the apology, asserts in debug builds, then carries on returning a dummy value
+  struct Apologize {
+    static constexpr bool checked   = true;
+    static constexpr bool recovers  = true;
+    static auto fail(const Apology apology) -> void { show(apology); }
+  }; // end of struct Apologize
+
+  /// @brief throws `Apology_error`
+  struct Throw {
+    static constexpr bool checked   = true;
+    static constexpr bool recovers  = false;
+    [[noreturn]] static auto fail(const Apology apology) -> void { throw Apology_error(apology); }
+  }; // end of struct Throw
+
+  /// @brief checks nothing, misuse is undefined behaviour, hot paths compile down to the pointer work
+  struct Unchecked {
+    static constexpr bool checked   = false;
+    static constexpr bool recovers  = false;
+    static constexpr auto fail(const Apology) noexcept -> void {}
+  }; // end of struct Unchecked
+} // namespace policy
+
+template <typename P>
+concept error_policy = requires (const Apology apology) {
+  { P::checked }  -> std::convertible_to<bool>;
+  { P::recovers } -> std::convertible_to<bool>;
+  P::fail(apology);
+};
+
+namespace detail {
+  /// @brief holds the `_failed_` value accessors hand out after an apology
+  template <typename T, bool = std::default_initializable<T>>
+  class Failed_slot {
+  protected:
+    T _failed_ = {};
+    //
+    constexpr auto failed()       noexcept -> T &       { return _failed_; }
+    constexpr auto failed() const noexcept -> const T & { return _failed_; }
+  }; // end of class Failed_slot
+
+  /// @brief no `_failed_` value is needed or none can be made, reaching `failed()` gives up
+  template <typename T>
+  class Failed_slot<T, false> {
+  protected:
+    [[noreturn]] auto failed() const noexcept -> T & { std::abort(); }
+  }; // end of class Failed_slot
+
+  /// @brief the slot a container using `Policy` needs
+  template <typename T, typename Policy>
+  using Failed_slot_for = Failed_slot<T, Policy::recovers && std::default_initializable<T>>;
+
+  /**
+  * @brief reports `apology` through `Policy` when `bad`, true when the caller must bail out,
+  *   always false without evaluating anything for unchecked policies
+  */
+  template <typename Policy>
+  [[nodiscard]] constexpr auto fails([[maybe_unused]] const bool bad, [[maybe_unused]] const Apology apology)
+      -> bool
+  {
+    if constexpr ( !Policy::checked ) {
+      return false;
+    } else {
+      if ( bad ) [[unlikely]] { Policy::fail(apology); return true; }
+      return false;
+    }
+  }
+} // namespace detail
+
 #endif // APOLOGY_HPP
@@ -0,0 +1,308 @@
+/**
+* @file concurrent_list.hpp
+* @brief `Concurrent_list_`, a lock-free list any number of threads can push to at both ends,
+*   pop from the front and traverse at the same time
+*/
+
+#ifndef CONCURRENT_LIST_HPP
+#define CONCURRENT_LIST_HPP
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <utility>
+#include "epoch.hpp"
+
+
+/**
+* @brief singly linked chain behind a dummy node, in the style of the Michael-Scott queue:
+*   `push_back` CASes the last `m_next` then swings `m_tail`, `push_front` CASes the dummy's
+*   `m_next`, `try_pop_front` freezes the dummy's `m_next` by marking it and makes the first
+*   node the new dummy, unlinked dummies are reclaimed through `ebr`
+*
+* traversal is weakly consistent: it sees every element present for its whole duration and
+* maybe some pushed or popped meanwhile. Elements are immutable once pushed, nodes come from
+* the global heap because reclamation may outlive the list
+* @tparam T copy constructible, popping copies since readers may still hold the element
+*/
+template <typename T>
+class Concurrent_list_
+{
+  struct Node {
+    std::atomic<std::uintptr_t> m_next = {0}; // `Node *`, low bit set once frozen
+    const bool                  m_filled;
+    union { T m_data; };
+    //
+    Node() noexcept : m_filled(false) {}
+    template <typename ...Args>
+    explicit Node(Args&& ...args) : m_filled(true), m_data(std::forward<Args>(args)...) {}
+    //
+    ~Node() { if ( m_filled ) { std::destroy_at(std::addressof(m_data)); } }
+  }; // end of struct Node
+
+  static constexpr std::uintptr_t frozen = 1;
+
+  alignas(64) std::atomic<Node *>       m_head  = {nullptr}; // the dummy
+  alignas(64) std::atomic<Node *>       m_tail  = {nullptr}; // the last node or one behind it
+  alignas(64) std::atomic<std::ptrdiff_t> m_size = {0}; // may dip below zero while a pop beats its push
+
+  [[nodiscard]] static auto to_node(const std::uintptr_t link)
+      noexcept -> Node *
+  {
+    return reinterpret_cast<Node *>(link & ~frozen);
+  }
+
+  [[nodiscard]] static auto to_link(const Node *node)
+      noexcept -> std::uintptr_t
+  {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+
+  static auto delete_node(void *node)
+      -> void
+  {
+    delete static_cast<Node *>(node);
+  }
+
+  /// @brief swings `m_head` from the frozen `dummy` to its successor, the winner retires `dummy`
+  auto advance_head(Node *dummy, const std::uintptr_t next)
+      -> void
+  {
+    if ( m_head.compare_exchange_strong(dummy, to_node(next), std::memory_order_acq_rel) ) {
+      ebr::retire(dummy, &delete_node);
+    }
+  }
+
+  auto link_back(Node *node)
+      -> void
+  {
+    const ebr::Guard guard;
+    while ( true ) {
+      Node          *last = m_tail.load(std::memory_order_acquire);
+      std::uintptr_t next = last->m_next.load(std::memory_order_acquire);
+      if ( next != 0 ) { // tail lags, help it along
+        m_tail.compare_exchange_weak(last, to_node(next), std::memory_order_release, std::memory_order_relaxed);
+        continue;
+      }
+      if ( last->m_next.compare_exchange_weak(next, to_link(node), std::memory_order_release, std::memory_order_relaxed) ) {
+        m_tail.compare_exchange_strong(last, node, std::memory_order_release, std::memory_order_relaxed);
+        break;
+      }
+    }
+    m_size.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  auto link_front(Node *node)
+      -> void
+  {
+    const ebr::Guard guard;
+    while ( true ) {
+      Node          *dummy = m_head.load(std::memory_order_acquire);
+      std::uintptr_t first = dummy->m_next.load(std::memory_order_acquire);
+      if ( (first & frozen) != 0 ) { advance_head(dummy, first); continue; }
+      node->m_next.store(first, std::memory_order_relaxed);
+      if ( dummy->m_next.compare_exchange_weak(first, to_link(node), std::memory_order_release, std::memory_order_relaxed) ) {
+        break;
+      }
+    }
+    m_size.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+  * @brief forward iterator over a guarded chain, only valid inside the `Reader` that made it
+  */
+  class const_iterator
+  {
+    friend class Concurrent_list_;
+    const Node *node_ptr = {nullptr};
+    explicit const_iterator(const Node *node) noexcept : node_ptr(node) {}
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T *;
+    using reference         = const T &;
+
+    const_iterator() noexcept = default;
+    //
+    auto operator*()  const noexcept -> reference { return node_ptr->m_data; }
+    auto operator->() const noexcept -> pointer   { return std::addressof(node_ptr->m_data); }
+    auto operator==(const const_iterator& rhs) const noexcept -> bool = default;
+    //
+    auto operator++() noexcept -> const_iterator& {
+      node_ptr = to_node(node_ptr->m_next.load(std::memory_order_acquire));
+      return *this;
+    }
+    auto operator++(int) noexcept -> const_iterator {
+      const_iterator old = *this;
+      ++*this;
+      return old;
+    }
+  }; // end of class const_iterator
+
+public:
+
+  /**
+  * @brief a range over the list that keeps the calling thread pinned, no node it can
+  *   reach is freed before it dies, keep it on one thread and short lived
+  */
+  class Reader
+  {
+    friend class Concurrent_list_;
+    const ebr::Guard  m_guard;
+    const Node       *m_first;
+    explicit Reader(const Concurrent_list_& list)
+      : m_first(to_node(list.m_head.load(std::memory_order_acquire)->m_next.load(std::memory_order_acquire))) {}
+
+  public:
+    [[nodiscard]] auto begin() const noexcept -> const_iterator { return const_iterator(m_first); }
+    [[nodiscard]] auto end()   const noexcept -> const_iterator { return const_iterator(); }
+  }; // end of class Reader
+
+  using value_type  = T;
+  using size_type   = std::size_t;
+
+  /* constructors */
+  Concurrent_list_() {
+    Node *dummy = new Node;
+    m_head.store(dummy, std::memory_order_relaxed);
+    m_tail.store(dummy, std::memory_order_relaxed);
+  }
+  //
+  Concurrent_list_(const Concurrent_list_&)             = delete;
+  Concurrent_list_& operator=(const Concurrent_list_&)  = delete;
+  //
+  /// @brief no other thread may use the list anymore
+  ~Concurrent_list_() {
+    Node *it = m_head.load(std::memory_order_acquire);
+    while ( it != nullptr ) {
+      Node *next = to_node(it->m_next.load(std::memory_order_relaxed));
+      delete it;
+      it = next;
+    }
+  }
+
+  /**
+  * @brief number of elements, exact when no push or pop is in flight
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  auto size() const noexcept
+      -> std::size_t
+  {
+    const std::ptrdiff_t size = m_size.load(std::memory_order_relaxed);
+    return size < 0 ? 0 : static_cast<std::size_t>(size);
+  }
+
+  /**
+  * @brief check if empty
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  auto is_empty() const
+      -> bool
+  {
+    const ebr::Guard guard;
+    return to_node(m_head.load(std::memory_order_acquire)->m_next.load(std::memory_order_acquire)) == nullptr;
+  }
+
+  /**
+  * @brief constructs an element at the end, lock-free
+  * @complexity O(1) amortized, retries under contention
+  */
+  template <typename ...Args>
+  auto emplace_back(Args&& ...args)
+      -> void
+  {
+    link_back( new Node(std::forward<Args>(args)...) );
+  }
+
+  /**
+  * @brief constructs an element at the beginning, lock-free
+  * @complexity O(1) amortized, retries under contention
+  */
+  template <typename ...Args>
+  auto emplace_front(Args&& ...args)
+      -> void
+  {
+    link_front( new Node(std::forward<Args>(args)...) );
+  }
+
+  auto push_back(const T &arg)  -> void { emplace_back(arg); }
+  auto push_back(T &&arg)       -> void { emplace_back(std::move(arg)); }
+  auto push_front(const T &arg) -> void { emplace_front(arg); }
+  auto push_front(T &&arg)      -> void { emplace_front(std::move(arg)); }
+
+  /**
+  * @brief removes the first element and returns a copy of it, lock-free
+  * @complexity O(1) amortized, retries under contention
+  * @return std::nullopt when the list is empty
+  */
+  auto try_pop_front()
+      -> std::optional<T>
+  {
+    const ebr::Guard guard;
+    while ( true ) {
+      Node          *dummy = m_head.load(std::memory_order_acquire);
+      std::uintptr_t first = dummy->m_next.load(std::memory_order_acquire);
+      if ( (first & frozen) != 0 ) { advance_head(dummy, first); continue; }
+      if ( first == 0 )            { return std::nullopt; }
+      Node *last = m_tail.load(std::memory_order_acquire);
+      if ( last == dummy ) { // never leave the tail on a node about to be retired
+        m_tail.compare_exchange_weak(last, to_node(first), std::memory_order_release, std::memory_order_relaxed);
+        continue;
+      }
+      if ( dummy->m_next.compare_exchange_weak(first, first | frozen, std::memory_order_acq_rel, std::memory_order_relaxed) ) {
+        std::optional<T> popped(std::in_place, to_node(first)->m_data);
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+        advance_head(dummy, first);
+        return popped;
+      }
+    }
+  }
+
+  /**
+  * @brief guarded range for traversal, `for (const T& x : list.reader())`
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  auto reader() const
+      -> Reader
+  {
+    return Reader(*this);
+  }
+
+  /**
+  * @brief calls `fn` on every element, see `reader()`
+  * @complexity O(n)
+  */
+  template <typename Fn>
+    requires std::invocable<Fn&, const T&>
+  auto for_each(Fn fn) const
+      -> void
+  {
+    for (const T& i : reader()) { fn(i); }
+  }
+
+  /**
+  * @brief search for a value
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]]
+  auto search(const T &target) const
+      -> bool
+  {
+    for (const T& i : reader()) {
+      if ( i == target ) { return true; }
+    }
+    return false;
+  }
+}; // end of class Concurrent_list_
+
+#endif // CONCURRENT_LIST_HPP
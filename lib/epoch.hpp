@@ -0,0 +1,242 @@
+/**
+* @file epoch.hpp
+* @brief process-wide epoch based reclamation for the lock-free containers,
+*   a node unlinked while other threads may still read it is `retire`d and freed
+*   once every thread has left the epoch it was retired in
+*/
+
+#ifndef EPOCH_HPP
+#define EPOCH_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+
+namespace ebr {
+
+/**
+* @brief the global epoch and one record per thread that ever entered a `Guard`,
+*   records of exited threads are reused, their unfreed garbage becomes orphans
+*   collected by whoever runs next
+*/
+class Domain
+{
+public:
+
+  struct Retired {
+    void          *m_ptr      = {nullptr};
+    void         (*m_deleter)(void *) = {nullptr};
+    std::uint64_t  m_epoch    = {};
+  }; // end of struct Retired
+
+  struct alignas(64) Record {
+    // 0 when outside a guard, otherwise `epoch << 1 | 1`
+    std::atomic<std::uint64_t>  m_state   = {0};
+    std::atomic<bool>           m_in_use  = {true};
+    Record                     *m_next    = {nullptr};
+  }; // end of struct Record
+
+private:
+
+  alignas(64) std::atomic<std::uint64_t>  m_epoch   = {0};
+  std::atomic<Record *>                   m_records = {nullptr};
+  std::mutex                              m_orphans_mutex;
+  std::vector<Retired>                    m_orphans;
+  std::atomic<bool>                       m_has_orphans = {false};
+
+public:
+
+  Domain() = default;
+  Domain(const Domain&)             = delete;
+  Domain& operator=(const Domain&)  = delete;
+  //
+  ~Domain() {
+    for (const Retired& r : m_orphans) { r.m_deleter(r.m_ptr); }
+    for (Record *it = m_records.load(); it != nullptr; ) {
+      Record *next = it->m_next;
+      delete it;
+      it = next;
+    }
+  }
+
+  [[nodiscard]] auto epoch()
+      const noexcept -> std::uint64_t
+  {
+    return m_epoch.load(std::memory_order_acquire);
+  }
+
+  /// @brief claims a free record or pushes a new one, records are never unlinked
+  auto acquire_record()
+      -> Record *
+  {
+    for (Record *it = m_records.load(std::memory_order_acquire); it != nullptr; it = it->m_next) {
+      bool expected = false;
+      if ( it->m_in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel) ) { return it; }
+    }
+    auto *record    = new Record;
+    record->m_next  = m_records.load(std::memory_order_relaxed);
+    while ( !m_records.compare_exchange_weak(record->m_next, record,
+                                             std::memory_order_release, std::memory_order_relaxed) ) {}
+    return record;
+  }
+
+  auto release_record(Record *record)
+      noexcept -> void
+  {
+    record->m_state.store(0, std::memory_order_release);
+    record->m_in_use.store(false, std::memory_order_release);
+  }
+
+  /// @brief bumps the global epoch if no thread is still pinned to an older one
+  auto try_advance()
+      noexcept -> std::uint64_t
+  {
+    std::uint64_t current = m_epoch.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (const Record *it = m_records.load(std::memory_order_acquire); it != nullptr; it = it->m_next) {
+      const std::uint64_t state = it->m_state.load(std::memory_order_acquire);
+      if ( (state & 1) != 0 && (state >> 1) != current ) { return current; }
+    }
+    if ( m_epoch.compare_exchange_strong(current, current + 1, std::memory_order_acq_rel) ) { return current + 1; }
+    return current;
+  }
+
+  /// @brief keeps garbage of an exiting thread until it is safe to free
+  auto adopt(std::vector<Retired>&& garbage)
+      -> void
+  {
+    if ( garbage.empty() ) { return; }
+    const std::lock_guard lock(m_orphans_mutex);
+    m_orphans.insert(m_orphans.end(), garbage.begin(), garbage.end());
+    m_has_orphans.store(true, std::memory_order_release);
+  }
+
+  /// @brief frees orphans retired at least two epochs before `epoch`
+  auto collect_orphans(const std::uint64_t epoch)
+      -> void
+  {
+    if ( !m_has_orphans.load(std::memory_order_acquire) ) { return; }
+    std::vector<Retired> ready;
+    {
+      const std::unique_lock lock(m_orphans_mutex, std::try_to_lock);
+      if ( !lock.owns_lock() ) { return; }
+      std::erase_if(m_orphans, [&](const Retired& r) {
+        if ( r.m_epoch + 2 > epoch ) { return false; }
+        ready.push_back(r);
+        return true;
+      });
+      m_has_orphans.store(!m_orphans.empty(), std::memory_order_release);
+    }
+    for (const Retired& r : ready) { r.m_deleter(r.m_ptr); }
+  }
+}; // end of class Domain
+
+/// @brief the domain shared by every container in the process
+inline auto domain()
+    -> Domain&
+{
+  static Domain instance;
+  return instance;
+}
+
+namespace detail {
+
+  /// @brief per-thread record and the garbage it retired, oldest first
+  class Local
+  {
+    Domain::Record               *m_record  = {nullptr};
+    std::vector<Domain::Retired>  m_garbage;
+    std::size_t                   m_depth   = {};
+    std::size_t                   m_since   = {}; // retires since the last collect
+
+  public:
+
+    static constexpr std::size_t collect_every = 64;
+
+    Local() : m_record(domain().acquire_record()) {}
+    Local(const Local&)             = delete;
+    Local& operator=(const Local&)  = delete;
+    //
+    ~Local() {
+      collect();
+      domain().adopt(std::move(m_garbage));
+      domain().release_record(m_record);
+    }
+
+    auto enter()
+        noexcept -> void
+    {
+      if ( m_depth++ != 0 ) { return; }
+      // an RMW keeps the release sequence of the last `leave`, the fence orders the pin before any read
+      m_record->m_state.exchange(domain().epoch() << 1 | 1, std::memory_order_acq_rel);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    auto leave()
+        noexcept -> void
+    {
+      if ( --m_depth != 0 ) { return; }
+      m_record->m_state.store(0, std::memory_order_release);
+    }
+
+    auto retire(void *ptr, void (*deleter)(void *))
+        -> void
+    {
+      m_garbage.push_back({ptr, deleter, domain().epoch()});
+      if ( ++m_since >= collect_every ) { collect(); }
+    }
+
+    /// @brief advances the epoch if it can and frees what no thread can still see
+    auto collect()
+        -> void
+    {
+      m_since = 0;
+      const std::uint64_t epoch = domain().try_advance();
+      std::size_t freed = 0;
+      for (; freed < m_garbage.size() && m_garbage[freed].m_epoch + 2 <= epoch; ++freed) {
+        m_garbage[freed].m_deleter(m_garbage[freed].m_ptr);
+      }
+      m_garbage.erase(m_garbage.begin(), m_garbage.begin() + static_cast<std::ptrdiff_t>(freed));
+      domain().collect_orphans(epoch);
+    }
+  }; // end of class Local
+
+  inline auto local()
+      -> Local&
+  {
+    thread_local Local instance;
+    return instance;
+  }
+
+} // namespace detail
+
+/**
+* @brief pins the calling thread to the current epoch, nodes reachable while a guard
+*   lives are not freed until it is gone, guards nest
+*/
+class Guard
+{
+public:
+  Guard()  { detail::local().enter(); }
+  ~Guard() { detail::local().leave(); }
+  //
+  Guard(const Guard&)             = delete;
+  Guard& operator=(const Guard&)  = delete;
+}; // end of class Guard
+
+/**
+* @brief hands `ptr` to the collector, `deleter(ptr)` runs once no guard that could
+*   have seen it is left, call it after `ptr` became unreachable
+*/
+inline auto retire(void *ptr, void (*deleter)(void *))
+    -> void
+{
+  detail::local().retire(ptr, deleter);
+}
+
+} // namespace ebr
+
+#endif // EPOCH_HPP
@@ -0,0 +1,968 @@
+/**
+* @file index_linked.hpp
+* @brief the doubly linked list behind `StaticList_` and `Index_list_`: elements live in slots
+*   of a `Storage` and link to each other by slot index, unused slots are chained into a free list
+*/
+
+#ifndef INDEX_LINKED_HPP
+#define INDEX_LINKED_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "apology.hpp"
+
+
+namespace detail {
+
+  /**
+  * @brief one slot, `m_data` is alive only while the slot is linked into the list; nothing is
+  *   initialized, a slot is written when first handed out, and for trivial `T` slots are trivial
+  *   so an array of them costs nothing to construct or destroy
+  */
+  template <typename T, typename Index>
+  struct Index_slot {
+    Index m_next;
+    Index m_prev;
+    union { T m_data; };
+    //
+    constexpr Index_slot() noexcept requires std::is_trivially_default_constructible_v<T> = default;
+    constexpr Index_slot() noexcept {}
+    constexpr ~Index_slot() requires std::is_trivially_destructible_v<T> = default;
+    constexpr ~Index_slot() {}
+    Index_slot(const Index_slot&)             = delete;
+    Index_slot& operator=(const Index_slot&)  = delete;
+  }; // end of struct Index_slot
+
+  /// @brief where the list starts and ends, the free list and the slot counts
+  template <typename Index>
+  struct Index_links {
+    static constexpr Index npos = std::numeric_limits<Index>::max();
+    //
+    Index m_head = {npos};
+    Index m_tail = {npos};
+    Index m_free = {npos}; // released slots chained by `m_next`
+    Index m_used = {};     // slots [0, m_used) were handed out at least once
+    Index m_size = {};
+  }; // end of struct Index_links
+
+  /// @brief the narrowest link type able to address `N` slots and the `npos` marker
+  template <std::size_t N>
+  using index_for = std::conditional_t<(N < UINT16_MAX), std::uint16_t, std::uint32_t>;
+
+/**
+* @brief list logic over index links, `Storage` owns the slots and provides
+*   `slots() -> Index_slot<T, Index> *`, `capacity() -> std::size_t`, a copy constructor making
+*   an empty storage and `growable`, optionally `links() -> Index_links<Index> &` to keep the
+*   head / tail / free list itself; growable storages either `extend(n)` in place, keeping the
+*   slot contents, or provide `allocate(n)`, `deallocate(slots, n)`, `adopt(slots, n)` and
+*   `take(other) -> bool` and steal on move
+*
+* a slot is handed out from the free list first, then from the never used tail of the storage,
+* then a growable storage doubles, keeping every slot where it was
+*/
+template <typename T, typename Index, typename Storage, typename Policy>
+class Index_linked_ : protected Failed_slot_for<T, Policy>
+{
+protected:
+
+  using slot_type = Index_slot<T, Index>;
+
+  static constexpr Index npos = std::numeric_limits<Index>::max();
+
+  /// @brief true when `Storage` keeps the links itself, in a mapped file for instance
+  static constexpr bool storage_links = requires (Storage& storage) {
+    { storage.links() } -> std::same_as<Index_links<Index> &>;
+  };
+
+  struct No_links {};
+
+  Storage m_storage;
+  [[no_unique_address]] std::conditional_t<storage_links, No_links, Index_links<Index>> m_links = {};
+
+  /// @brief head, tail, free list and counts, in `Storage` when it keeps them, never cache the reference across a `grow`
+  [[nodiscard]] constexpr auto links() noexcept -> Index_links<Index> & {
+    if constexpr ( storage_links ) { return m_storage.links(); }
+    else                           { return m_links; }
+  }
+  [[nodiscard]] constexpr auto links() const noexcept -> const Index_links<Index> & {
+    if constexpr ( storage_links ) { return m_storage.links(); }
+    else                           { return m_links; }
+  }
+
+  using Failed_slot_for<T, Policy>::failed;
+
+  /// @brief true when the operation must bail out, see `detail::fails`
+  [[nodiscard]] static constexpr auto fails(const bool bad, const Apology apology)
+      -> bool
+  {
+    return detail::fails<Policy>(bad, apology);
+  }
+
+  [[nodiscard]] constexpr auto slot(const Index i)       noexcept -> slot_type &       { return m_storage.slots()[i]; }
+  [[nodiscard]] constexpr auto slot(const Index i) const noexcept -> const slot_type & { return m_storage.slots()[i]; }
+
+  /// @brief takes a free slot, `npos` when the storage is full and cannot grow
+  constexpr
+  auto acquire()
+      -> Index
+  {
+    if ( links().m_free != npos ) {
+      const Index i = links().m_free;
+      links().m_free = slot(i).m_next;
+      return i;
+    }
+    if ( links().m_used < m_storage.capacity() ) { return links().m_used++; }
+    if constexpr ( Storage::growable ) {
+      const std::size_t capacity = m_storage.capacity();
+      if ( capacity < npos ) {
+        grow(std::min<std::size_t>(npos, std::max<std::size_t>(8, capacity * 2)));
+        return links().m_used++;
+      }
+    }
+    return npos;
+  }
+
+  /// @brief takes a growable storage to `capacity` slots, every element stays in its slot
+  constexpr
+  auto grow(const std::size_t capacity)
+      -> void
+    requires Storage::growable
+  {
+    if constexpr ( requires { m_storage.extend(capacity); } ) { m_storage.extend(capacity); }
+    else                                                     { relocate(capacity, false); }
+  }
+
+  /**
+  * @brief moves every element into a fresh buffer of `capacity` slots; in the same slots
+  *   when `!in_order`, so indices and iterators stay valid, otherwise into slots [0, size) in list
+  *   order. Elements that may throw on move are copied so a failure leaves the list untouched
+  */
+  constexpr
+  auto relocate(const std::size_t capacity, const bool in_order)
+      -> void
+    requires Storage::growable
+  {
+    slot_type *fresh = m_storage.allocate(capacity);
+    Index      moved = 0;
+    try {
+      for (Index i = links().m_head; i != npos; i = slot(i).m_next, ++moved) {
+        std::construct_at(std::addressof(fresh[in_order ? moved : i].m_data), std::move_if_noexcept(slot(i).m_data));
+      }
+    } catch (...) {
+      Index i = links().m_head;
+      for (Index k = 0; k < moved; ++k, i = slot(i).m_next) { std::destroy_at(std::addressof(fresh[in_order ? k : i].m_data)); }
+      m_storage.deallocate(fresh, capacity);
+      throw;
+    }
+    for (Index i = links().m_head; i != npos; i = slot(i).m_next) { std::destroy_at(std::addressof(slot(i).m_data)); }
+    if ( in_order ) {
+      for (Index k = 0; k < moved; ++k) {
+        fresh[k].m_prev = ( k == 0 ) ? npos : static_cast<Index>(k - 1);
+        fresh[k].m_next = ( k + 1u == moved ) ? npos : static_cast<Index>(k + 1);
+      }
+      links().m_head = ( moved != 0 ) ? 0 : npos;
+      links().m_tail = ( moved != 0 ) ? static_cast<Index>(moved - 1) : npos;
+      links().m_free = npos;
+      links().m_used = moved;
+    } else {
+      for (Index k = 0; k < links().m_used; ++k) {
+        fresh[k].m_next = slot(k).m_next;
+        fresh[k].m_prev = slot(k).m_prev;
+      }
+    }
+    m_storage.adopt(fresh, capacity);
+  }
+
+  /// @brief empty list over `storage`, for storages carrying state such as an allocator
+  explicit constexpr Index_linked_(Storage&& storage) noexcept
+    : m_storage(std::move(storage)) {}
+
+  /// @brief takes the links of `rhs`, whose slots this storage just took over, a storage keeping its links brought them along
+  constexpr
+  auto take_links(Index_linked_& rhs)
+      noexcept -> void
+  {
+    if constexpr ( !storage_links ) { links() = std::exchange(rhs.links(), Index_links<Index>{}); }
+  }
+
+  /// @brief gives `i` back to the free list, its element must be gone
+  constexpr
+  auto release(const Index i)
+      noexcept -> void
+  {
+    slot(i).m_next  = links().m_free;
+    links().m_free  = i;
+  }
+
+  /// @brief constructs an element from `args` in a free slot, `npos` when full
+  template <typename ...Args>
+  constexpr
+  auto create(Args&& ...args)
+      -> Index
+  {
+    if constexpr ( Storage::growable ) {
+      if ( links().m_free == npos && links().m_used == m_storage.capacity() ) {
+        // the arguments may refer to elements about to move, build the value before growing
+        T value(std::forward<Args>(args)...);
+        const Index i = acquire();
+        if ( i == npos ) { return npos; }
+        try {
+          std::construct_at(std::addressof(slot(i).m_data), std::move(value));
+        } catch (...) {
+          release(i);
+          throw;
+        }
+        return i;
+      }
+    }
+    const Index i = acquire();
+    if ( i == npos ) { return npos; }
+    try {
+      std::construct_at(std::addressof(slot(i).m_data), std::forward<Args>(args)...);
+    } catch (...) {
+      release(i);
+      throw;
+    }
+    return i;
+  }
+
+  /// @brief links the filled slot `i` before `pos`, `npos` means after the tail
+  constexpr
+  auto link_before(const Index pos, const Index i)
+      noexcept -> void
+  {
+    const Index prev = ( pos != npos ) ? slot(pos).m_prev : links().m_tail;
+    slot(i).m_prev = prev;
+    slot(i).m_next = pos;
+    if ( prev != npos ) { slot(prev).m_next = i; }
+    else                { links().m_head = i; }
+    if ( pos != npos )  { slot(pos).m_prev = i; }
+    else                { links().m_tail = i; }
+    ++links().m_size;
+  }
+
+  /// @brief unlinks slot `i`, destroys its element and frees it
+  constexpr
+  auto unlink(const Index i)
+      noexcept -> void
+  {
+    const Index prev = slot(i).m_prev;
+    const Index next = slot(i).m_next;
+    if ( prev != npos ) { slot(prev).m_next = next; }
+    else                { links().m_head = next; }
+    if ( next != npos ) { slot(next).m_prev = prev; }
+    else                { links().m_tail = prev; }
+    std::destroy_at(std::addressof(slot(i).m_data));
+    release(i);
+    --links().m_size;
+  }
+
+  /// @brief slot of the element at `pos`, `pos` must be valid, walks from the nearer end
+  [[nodiscard]]
+  constexpr
+  auto index_at(const std::size_t pos)
+      const noexcept -> Index
+  {
+    Index i = links().m_head;
+    if ( pos <= links().m_size / 2u ) {
+      for (std::size_t k = 0; k < pos; ++k) { i = slot(i).m_next; }
+    } else {
+      i = links().m_tail;
+      for (std::size_t k = links().m_size - 1u; k > pos; --k) { i = slot(i).m_prev; }
+    }
+    return i;
+  }
+
+  /// @brief first slot holding `value` or `npos`
+  [[nodiscard]]
+  constexpr
+  auto find_index(const T& value)
+      const -> Index
+  {
+    for (Index i = links().m_head; i != npos; i = slot(i).m_next) {
+      if ( slot(i).m_data == value ) { return i; }
+    }
+    return npos;
+  }
+
+  /// @brief merges two sorted runs chained through `m_next` only, on ties `first` wins
+  template <typename Compare>
+  constexpr
+  auto merge_runs(Index first, Index second, Compare& comp)
+      -> Index
+  {
+    Index  head = npos;
+    Index *tail = &head;
+    while ( first != npos && second != npos ) {
+      if ( comp(slot(second).m_data, slot(first).m_data) ) { *tail = second; second = slot(second).m_next; }
+      else                                                 { *tail = first;  first  = slot(first).m_next;  }
+      tail = &slot(*tail).m_next;
+    }
+    *tail = ( first != npos ) ? first : second;
+    return head;
+  }
+
+  /// @brief makes `head` the chain of the list, restoring `m_prev` and `links().m_tail` from `m_next`
+  constexpr
+  auto relink(const Index head)
+      noexcept -> void
+  {
+    links().m_head      = head;
+    Index prev  = npos;
+    for (Index i = head; i != npos; i = slot(i).m_next) {
+      slot(i).m_prev  = prev;
+      prev            = i;
+    }
+    links().m_tail = prev;
+  }
+
+  /// @brief destroys every element and forgets every slot
+  constexpr
+  auto release_all()
+      noexcept -> void
+  {
+    for (Index i = links().m_head; i != npos; i = slot(i).m_next) { std::destroy_at(std::addressof(slot(i).m_data)); }
+    links().m_head = links().m_tail = links().m_free = npos;
+    links().m_used = links().m_size = 0;
+  }
+
+  /**
+  * @brief bidirectional iterator over slot indices, `end()` is `npos` but knows its list
+  *   so `--end()` is the tail
+  * @tparam Const true for `const_iterator`
+  */
+  template <bool Const>
+  class basic_iterator {
+  private:
+    friend class Index_linked_;
+    template <bool> friend class basic_iterator;
+    using list_type = std::conditional_t<Const, const Index_linked_, Index_linked_>;
+    //
+    list_type *list_ptr {nullptr};
+    Index      index    {npos};
+    //
+    constexpr basic_iterator(list_type *list, const Index i) noexcept
+      : list_ptr(list), index(i) {}
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, const T *, T *>;
+    using reference         = std::conditional_t<Const, const T &, T &>;
+    //
+    constexpr basic_iterator() noexcept = default;
+    // iterator -> const_iterator
+    constexpr basic_iterator(const basic_iterator<!Const>& other) noexcept requires Const
+      : list_ptr(other.list_ptr), index(other.index) {}
+    //
+    template <bool C>
+    constexpr bool operator==(const basic_iterator<C>& rhs) const noexcept {
+      return index == rhs.index;
+    }
+    //
+    constexpr reference operator*() const noexcept {
+      return list_ptr->slot(index).m_data;
+    }
+    //
+    constexpr pointer operator->() const noexcept {
+      return std::addressof(list_ptr->slot(index).m_data);
+    }
+    // pre increment
+    constexpr basic_iterator& operator++() noexcept {
+      index = list_ptr->slot(index).m_next;
+      return *this;
+    }
+    // pre decrement
+    constexpr basic_iterator& operator--() noexcept {
+      index = ( index != npos ) ? list_ptr->slot(index).m_prev : list_ptr->links().m_tail;
+      return *this;
+    }
+    // post increment
+    constexpr basic_iterator operator++(int) noexcept {
+      basic_iterator old = *this;
+      ++*this;
+      return old;
+    }
+    // post decrement
+    constexpr basic_iterator operator--(int) noexcept {
+      basic_iterator old = *this;
+      --*this;
+      return old;
+    }
+  }; // end of class basic_iterator
+
+public:
+
+  using value_type              = T;
+  using size_type               = std::size_t;
+  using difference_type         = std::ptrdiff_t;
+  using reference               = T &;
+  using const_reference         = const T &;
+  using iterator                = basic_iterator<false>;
+  using const_iterator          = basic_iterator<true>;
+  using reverse_iterator        = std::reverse_iterator<iterator>;
+  using const_reverse_iterator  = std::reverse_iterator<const_iterator>;
+
+  [[nodiscard]] constexpr auto begin()  const noexcept -> const_iterator { return const_iterator(this, links().m_head); }
+  [[nodiscard]] constexpr auto end()    const noexcept -> const_iterator { return const_iterator(this, npos); }
+  [[nodiscard]] constexpr auto begin()  noexcept -> iterator { return iterator(this, links().m_head); }
+  [[nodiscard]] constexpr auto end()    noexcept -> iterator { return iterator(this, npos); }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] constexpr auto cend()   const noexcept -> const_iterator { return end(); }
+  //
+  [[nodiscard]] constexpr auto rbegin()   const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+  [[nodiscard]] constexpr auto rend()     const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+  [[nodiscard]] constexpr auto rbegin()   noexcept -> reverse_iterator { return reverse_iterator(end()); }
+  [[nodiscard]] constexpr auto rend()     noexcept -> reverse_iterator { return reverse_iterator(begin()); }
+  [[nodiscard]] constexpr auto crbegin()  const noexcept -> const_reverse_iterator { return rbegin(); }
+  [[nodiscard]] constexpr auto crend()    const noexcept -> const_reverse_iterator { return rend(); }
+
+  /* constructors */
+  constexpr Index_linked_() = default;
+  //
+  constexpr Index_linked_(const Index_linked_& rhs)
+    : Failed_slot_for<T, Policy>(), m_storage(rhs.m_storage) {
+    if constexpr ( Storage::growable ) {
+      if ( rhs.links().m_size != 0 ) { m_storage.adopt(m_storage.allocate(rhs.links().m_size), rhs.links().m_size); }
+    }
+    for (const T& v : rhs) { emplace_back(v); }
+  }
+  //
+  /// @brief takes the slots of a growable storage, otherwise moves element by element, `rhs` ends empty
+  constexpr Index_linked_(Index_linked_&& rhs)
+      noexcept(Storage::growable || std::is_nothrow_move_constructible_v<T>)
+    : Failed_slot_for<T, Policy>(), m_storage(std::move(rhs.m_storage)) {
+    if constexpr ( Storage::growable ) {
+      take_links(rhs);
+    } else {
+      for (T& v : rhs) { emplace_back(std::move(v)); }
+      rhs.clear();
+    }
+  }
+  //
+  constexpr Index_linked_(std::initializer_list<T> values) {
+    for (const T& v : values) { emplace_back(v); }
+  }
+  //
+  constexpr auto operator=(const Index_linked_& rhs)
+      -> Index_linked_&
+  {
+    if ( this == &rhs ) { return *this; }
+    clear();
+    for (const T& v : rhs) { emplace_back(v); }
+    return *this;
+  }
+  //
+  constexpr auto operator=(Index_linked_&& rhs)
+      -> Index_linked_&
+  {
+    if ( this == &rhs ) { return *this; }
+    clear();
+    if constexpr ( Storage::growable ) {
+      if ( m_storage.take(rhs.m_storage) ) { take_links(rhs); return *this; }
+    }
+    for (T& v : rhs) { emplace_back(std::move(v)); }
+    rhs.clear();
+    return *this;
+  }
+  //
+  /// @brief a storage keeping its links keeps the elements as well, they outlive the object
+  constexpr ~Index_linked_() {
+    if constexpr ( !storage_links ) { release_all(); }
+  }
+
+  /**
+  * @brief check if empty
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto is_empty() const noexcept
+      -> bool
+  {
+    return links().m_size == 0;
+  }
+
+  /**
+  * @brief check if no slot is left without growing
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto is_full() const noexcept
+      -> bool
+  {
+    return links().m_size == m_storage.capacity();
+  }
+
+  /**
+  * @brief returns size of the list
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto size() const noexcept
+      -> std::size_t
+  {
+    return links().m_size;
+  }
+
+  /**
+  * @brief how many elements fit without growing
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto capacity() const noexcept
+      -> std::size_t
+  {
+    return m_storage.capacity();
+  }
+
+  /**
+  * @brief returns first element
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto front()
+      -> T &
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return failed(); }
+    return slot(links().m_head).m_data;
+  }
+
+  [[nodiscard]]
+  constexpr
+  auto front() const
+      -> const T &
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return failed(); }
+    return slot(links().m_head).m_data;
+  }
+
+  /**
+  * @brief returns last element
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto back()
+      -> T &
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return failed(); }
+    return slot(links().m_tail).m_data;
+  }
+
+  [[nodiscard]]
+  constexpr
+  auto back() const
+      -> const T &
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return failed(); }
+    return slot(links().m_tail).m_data;
+  }
+
+  /**
+  * @brief return element at given position, walks from the nearer end
+  * @complexity O(min(pos, size - pos))
+  */
+  [[nodiscard]]
+  constexpr
+  auto at(const std::size_t pos)
+      -> T &
+  {
+    if ( fails(pos >= links().m_size, Apology::invalid_position) ) { return failed(); }
+    return slot(index_at(pos)).m_data;
+  }
+
+  [[nodiscard]]
+  constexpr
+  auto at(const std::size_t pos) const
+      -> const T &
+  {
+    if ( fails(pos >= links().m_size, Apology::invalid_position) ) { return failed(); }
+    return slot(index_at(pos)).m_data;
+  }
+
+  /**
+  * @brief first element or null when empty, never apologizes
+  * @complexity O(1)
+  */
+  [[nodiscard]] constexpr auto try_front()       noexcept -> T *       { return is_empty() ? nullptr : std::addressof(slot(links().m_head).m_data); }
+  [[nodiscard]] constexpr auto try_front() const noexcept -> const T * { return is_empty() ? nullptr : std::addressof(slot(links().m_head).m_data); }
+
+  /**
+  * @brief last element or null when empty, never apologizes
+  * @complexity O(1)
+  */
+  [[nodiscard]] constexpr auto try_back()       noexcept -> T *       { return is_empty() ? nullptr : std::addressof(slot(links().m_tail).m_data); }
+  [[nodiscard]] constexpr auto try_back() const noexcept -> const T * { return is_empty() ? nullptr : std::addressof(slot(links().m_tail).m_data); }
+
+  /**
+  * @brief constructs an element in place at the end of list
+  * @complexity O(1)
+  * @return T& the new element
+  */
+  template <typename ...Args>
+  constexpr
+  auto emplace_back(Args&& ...args)
+      -> T &
+  {
+    const Index i = create(std::forward<Args>(args)...);
+    if ( fails(i == npos, Apology::full) ) { return failed(); }
+    link_before(npos, i);
+    return slot(i).m_data;
+  }
+
+  /**
+  * @brief constructs an element in place at the beginning of list
+  * @complexity O(1)
+  * @return T& the new element
+  */
+  template <typename ...Args>
+  constexpr
+  auto emplace_front(Args&& ...args)
+      -> T &
+  {
+    const Index i = create(std::forward<Args>(args)...);
+    if ( fails(i == npos, Apology::full) ) { return failed(); }
+    link_before(links().m_head, i);
+    return slot(i).m_data;
+  }
+
+  /**
+  * @brief add element at end of list
+  * @complexity O(1)
+  */
+  constexpr auto push_back(const T &arg) -> void { (void)emplace_back(arg); }
+  constexpr auto push_back(T &&arg)      -> void { (void)emplace_back(std::move(arg)); }
+
+  /**
+  * @brief add element at the beginning of list
+  * @complexity O(1)
+  */
+  constexpr auto push_front(const T &arg) -> void { (void)emplace_front(arg); }
+  constexpr auto push_front(T &&arg)      -> void { (void)emplace_front(std::move(arg)); }
+
+  /**
+  * @brief add element at end of list unless full, never apologizes
+  * @complexity O(1)
+  * @return false when full
+  */
+  template <typename ...Args>
+  constexpr
+  auto try_emplace_back(Args&& ...args)
+      -> bool
+  {
+    const Index i = create(std::forward<Args>(args)...);
+    if ( i == npos ) { return false; }
+    link_before(npos, i);
+    return true;
+  }
+
+  /**
+  * @brief add element at the beginning of list unless full, never apologizes
+  * @complexity O(1)
+  * @return false when full
+  */
+  template <typename ...Args>
+  constexpr
+  auto try_emplace_front(Args&& ...args)
+      -> bool
+  {
+    const Index i = create(std::forward<Args>(args)...);
+    if ( i == npos ) { return false; }
+    link_before(links().m_head, i);
+    return true;
+  }
+
+  /**
+  * @brief add element at given position, like `List_` the first position prepends and the last appends
+  * @complexity O(min(pos, size - pos))
+  */
+  constexpr
+  auto push_at(const std::size_t pos, const T &arg)
+      -> void
+  {
+    if ( fails(pos >= links().m_size, Apology::invalid_position) ) { return; }
+    const Index i = create(arg);
+    if ( fails(i == npos, Apology::full) ) { return; }
+    link_before(pos == 0 ? links().m_head : pos == links().m_size - 1u ? npos : index_at(pos), i);
+  }
+
+  constexpr
+  auto push_at(const std::size_t pos, T &&arg)
+      -> void
+  {
+    if ( fails(pos >= links().m_size, Apology::invalid_position) ) { return; }
+    const Index i = create(std::move(arg));
+    if ( fails(i == npos, Apology::full) ) { return; }
+    link_before(pos == 0 ? links().m_head : pos == links().m_size - 1u ? npos : index_at(pos), i);
+  }
+
+  /**
+  * @brief inserts `arg` before `pos`, `end()` appends
+  * @complexity O(1)
+  * @return iterator to the inserted element, `end()` when full
+  */
+  template <typename ...Args>
+  constexpr
+  auto emplace(const_iterator pos, Args&& ...args)
+      -> iterator
+  {
+    if ( fails(pos.list_ptr != this, Apology::invalid_position) ) { return end(); }
+    const Index i = create(std::forward<Args>(args)...);
+    if ( fails(i == npos, Apology::full) ) { return end(); }
+    link_before(pos.index, i);
+    return iterator(this, i);
+  }
+
+  constexpr auto insert(const_iterator pos, const T &arg) -> iterator { return emplace(pos, arg); }
+  constexpr auto insert(const_iterator pos, T &&arg)      -> iterator { return emplace(pos, std::move(arg)); }
+
+  /**
+  * @brief removes the element at `pos`
+  * @complexity O(1)
+  * @return iterator to the element after the removed one
+  */
+  constexpr
+  auto erase(const_iterator pos)
+      -> iterator
+  {
+    if ( fails(pos.list_ptr != this || pos.index == npos, Apology::invalid_position) ) { return end(); }
+    const Index next = slot(pos.index).m_next;
+    unlink(pos.index);
+    return iterator(this, next);
+  }
+
+  /**
+  * @brief remove last element
+  * @complexity O(1)
+  */
+  constexpr
+  auto pop_back()
+      -> void
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return; }
+    unlink(links().m_tail);
+  }
+
+  /**
+  * @brief remove first element
+  * @complexity O(1)
+  */
+  constexpr
+  auto pop_front()
+      -> void
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return; }
+    unlink(links().m_head);
+  }
+
+  /**
+  * @brief removes and returns the first element, nothing when empty, never apologizes
+  * @complexity O(1)
+  */
+  constexpr
+  auto try_pop_front()
+      -> std::optional<T>
+  {
+    if ( is_empty() ) { return std::nullopt; }
+    std::optional<T> value( std::move(slot(links().m_head).m_data) );
+    unlink(links().m_head);
+    return value;
+  }
+
+  /**
+  * @brief removes and returns the last element, nothing when empty, never apologizes
+  * @complexity O(1)
+  */
+  constexpr
+  auto try_pop_back()
+      -> std::optional<T>
+  {
+    if ( is_empty() ) { return std::nullopt; }
+    std::optional<T> value( std::move(slot(links().m_tail).m_data) );
+    unlink(links().m_tail);
+    return value;
+  }
+
+  /**
+  * @brief remove element at given position
+  * @complexity O(min(pos, size - pos))
+  */
+  constexpr
+  auto pop_at(const std::size_t pos)
+      -> void
+  {
+    if ( fails(pos >= links().m_size, Apology::invalid_position) ) { return; }
+    unlink(index_at(pos));
+  }
+
+  /**
+  * @brief removes every element equal to `value`, `value` may be one of them
+  * @complexity O(n)
+  * @return number of removed elements
+  */
+  constexpr
+  auto remove(const T& value)
+      -> std::size_t
+  {
+    const std::size_t before  = links().m_size;
+    Index             self    = npos; // the slot holding `value` itself goes last
+    for (Index i = links().m_head; i != npos; ) {
+      const Index next = slot(i).m_next;
+      if ( slot(i).m_data == value ) {
+        if ( std::addressof(slot(i).m_data) == std::addressof(value) ) { self = i; }
+        else                                                           { unlink(i); }
+      }
+      i = next;
+    }
+    if ( self != npos ) { unlink(self); }
+    return before - links().m_size;
+  }
+
+  /**
+  * @brief removes every element satisfying `pred`
+  * @complexity O(n)
+  * @return number of removed elements
+  */
+  template <typename Pred>
+    requires std::predicate<Pred&, const T&>
+  constexpr
+  auto remove_if(Pred pred)
+      -> std::size_t
+  {
+    const std::size_t before = links().m_size;
+    for (Index i = links().m_head; i != npos; ) {
+      const Index next = slot(i).m_next;
+      if ( pred(std::as_const(slot(i).m_data)) ) { unlink(i); }
+      i = next;
+    }
+    return before - links().m_size;
+  }
+
+  /**
+  * @brief search for a value
+  * @complexity O(n)
+  */
+  [[nodiscard]]
+  constexpr
+  auto search(const T &target) const
+      -> bool
+  {
+    return find_index(target) != npos;
+  }
+
+  /**
+  * @brief returns the position of the first element equal to target
+  * @complexity O(n)
+  * @return std::int64_t, -1 when not found
+  */
+  [[nodiscard]]
+  constexpr
+  auto locate(const T &target) const
+      -> std::int64_t
+  {
+    std::int64_t j = 0;
+    for (Index i = links().m_head; i != npos; i = slot(i).m_next, ++j) {
+      if ( slot(i).m_data == target ) { return j; }
+    }
+    return -1;
+  }
+
+  /**
+  * @brief number of elements equal to target
+  * @complexity O(n)
+  */
+  [[nodiscard]]
+  constexpr
+  auto count(const T &target) const
+      -> std::size_t
+  {
+    return static_cast<std::size_t>(std::count(begin(), end(), target));
+  }
+
+  /**
+  * @brief: stable merge sort ordering elements by `comp`, only links change, elements never move
+  * @complexity  O(n log(n))
+  * @param comp `comp(a, b)` is true when `a` goes before `b`
+  */
+  template <typename Compare>
+    requires std::predicate<Compare&, const T&, const T&>
+  constexpr
+  auto sort(Compare comp)
+      -> void
+  {
+    // runs[i] holds a sorted run of 2^i elements, higher runs hold earlier elements
+    Index runs[std::numeric_limits<Index>::digits + 1];
+    std::fill(std::begin(runs), std::end(runs), npos);
+    Index i = links().m_head;
+    while ( i != npos ) {
+      Index carry     = i;
+      i               = slot(i).m_next;
+      slot(carry).m_next = npos;
+      std::size_t k = 0;
+      for (; runs[k] != npos; ++k) {
+        carry   = merge_runs(runs[k], carry, comp);
+        runs[k] = npos;
+      }
+      runs[k] = carry;
+    }
+    Index sorted = npos;
+    for (const Index run : runs) {
+      if ( run != npos ) { sorted = merge_runs(run, sorted, comp); }
+    }
+    relink(sorted);
+  }
+
+  /**
+  * @brief: sorts element in ASC order by default, put `true` for DESC
+  * @complexity  O(n log(n))
+  */
+  constexpr
+  auto sort(const bool desc = false)
+      -> void
+  {
+    if ( desc ) { sort( std::greater<>{} ); return; }
+    sort( std::less<>{} );
+  }
+
+  /**
+  * @brief check if the list is sorted ASC
+  * @complexity O(n)
+  */
+  [[nodiscard]]
+  constexpr
+  auto is_sorted() const
+      -> bool
+  {
+    return std::is_sorted(begin(), end());
+  }
+
+  /**
+  * @brief erases the list, every slot is free again
+  * @complexity O(n)
+  */
+  constexpr
+  auto clear()
+      noexcept -> void
+  {
+    release_all();
+  }
+}; // end of class Index_linked_
+
+} // namespace detail
+
+#endif // INDEX_LINKED_HPP
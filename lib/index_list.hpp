@@ -0,0 +1,168 @@
+/**
+* @file index_list.hpp
+* @brief `Index_list_`, a doubly linked list whose nodes live in one growable array and link
+*   to each other by 32 bit indices, half the link overhead of `List_` on 64 bit builds,
+*   `compact()` puts the nodes back in traversal order after churn
+*/
+
+#ifndef INDEX_LIST_HPP
+#define INDEX_LIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include "apology.hpp"
+#include "index_linked.hpp"
+
+
+namespace detail {
+
+  /// @brief slots in one buffer from `Alloc`, regrown by the list, taken over on move
+  template <typename T, typename Index, typename Alloc>
+  class Heap_slots
+  {
+    using slot_type       = Index_slot<T, Index>;
+    using slot_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<slot_type>;
+    using traits          = std::allocator_traits<slot_allocator>;
+
+    slot_type                           *m_slots    = nullptr;
+    std::size_t                         m_capacity  = {};
+    [[no_unique_address]] slot_allocator m_alloc    = {};
+
+  public:
+    static constexpr bool growable = true;
+    //
+    constexpr Heap_slots() noexcept = default;
+    //
+    explicit constexpr Heap_slots(const Alloc& alloc) noexcept
+      : m_alloc(alloc) {}
+    //
+    /// @brief empty, with the allocator a copy of the container gets
+    constexpr Heap_slots(const Heap_slots& rhs) noexcept
+      : m_alloc(traits::select_on_container_copy_construction(rhs.m_alloc)) {}
+    //
+    constexpr Heap_slots(Heap_slots&& rhs) noexcept
+      : m_slots(std::exchange(rhs.m_slots, nullptr)),
+        m_capacity(std::exchange(rhs.m_capacity, 0)),
+        m_alloc(std::move(rhs.m_alloc)) {}
+    //
+    Heap_slots& operator=(const Heap_slots&) = delete;
+    //
+    constexpr ~Heap_slots() { if ( m_slots != nullptr ) { deallocate(m_slots, m_capacity); } }
+    //
+    constexpr auto slots()       noexcept -> slot_type *       { return m_slots; }
+    constexpr auto slots() const noexcept -> const slot_type * { return m_slots; }
+    //
+    constexpr auto capacity() const noexcept -> std::size_t { return m_capacity; }
+    //
+    constexpr auto get_allocator() const noexcept -> Alloc { return Alloc(m_alloc); }
+    //
+    /// @brief `n` empty slots, not yet ours
+    constexpr
+    auto allocate(const std::size_t n)
+        -> slot_type *
+    {
+      slot_type *slots = traits::allocate(m_alloc, n);
+      for (std::size_t i = 0; i < n; ++i) { traits::construct(m_alloc, slots + i); }
+      return slots;
+    }
+    //
+    /// @brief gives back slots from `allocate`, their elements must be gone already
+    constexpr
+    auto deallocate(slot_type *slots, const std::size_t n)
+        noexcept -> void
+    {
+      for (std::size_t i = 0; i < n; ++i) { traits::destroy(m_alloc, slots + i); }
+      traits::deallocate(m_alloc, slots, n);
+    }
+    //
+    /// @brief frees the current buffer, whose elements must be gone already, and uses `slots` instead
+    constexpr
+    auto adopt(slot_type *slots, const std::size_t n)
+        noexcept -> void
+    {
+      if ( m_slots != nullptr ) { deallocate(m_slots, m_capacity); }
+      m_slots     = slots;
+      m_capacity  = n;
+    }
+    //
+    /// @brief takes the buffer of `rhs` when the allocators allow, the caller emptied this one
+    constexpr
+    auto take(Heap_slots& rhs)
+        noexcept -> bool
+    {
+      if constexpr ( !traits::propagate_on_container_move_assignment::value && !traits::is_always_equal::value ) {
+        if ( m_alloc != rhs.m_alloc ) { return false; }
+      }
+      adopt(std::exchange(rhs.m_slots, nullptr), std::exchange(rhs.m_capacity, 0));
+      if constexpr ( traits::propagate_on_container_move_assignment::value ) { m_alloc = std::move(rhs.m_alloc); }
+      return true;
+    }
+  }; // end of class Heap_slots
+
+} // namespace detail
+
+/**
+* @brief same push/pop/at/search/sort api as `List_`, nodes are slots of one array growing by
+*   doubling, growing keeps every element in its slot so iterators survive it, `compact()` does not
+*
+* @tparam T element type
+* @tparam Alloc allocator of the slot array, rebound
+* @tparam Policy what happens on misuse, see `policy`
+*/
+template <typename T, typename Alloc = std::allocator<T>, error_policy Policy = policy::Apologize>
+class Index_list_
+  : public detail::Index_linked_<T, std::uint32_t, detail::Heap_slots<T, std::uint32_t, Alloc>, Policy>
+{
+  using base = detail::Index_linked_<T, std::uint32_t, detail::Heap_slots<T, std::uint32_t, Alloc>, Policy>;
+
+public:
+
+  using index_type      = std::uint32_t;
+  using allocator_type  = Alloc;
+
+  using base::base;
+
+  constexpr Index_list_() = default;
+  //
+  explicit constexpr Index_list_(const Alloc& alloc) noexcept
+    : base(detail::Heap_slots<T, std::uint32_t, Alloc>(alloc)) {}
+
+  [[nodiscard]] constexpr auto get_allocator() const noexcept -> Alloc { return this->m_storage.get_allocator(); }
+
+  /**
+  * @brief makes room for `n` elements without growing again, elements keep their slots
+  * @complexity O(size) when growing, O(1) otherwise
+  */
+  constexpr
+  auto reserve(const std::size_t n)
+      -> void
+  {
+    if ( this->fails(n > base::npos, Apology::full) ) { return; }
+    if ( n > this->m_storage.capacity() ) { this->grow(n); }
+  }
+
+  /**
+  * @brief rewrites the slots in traversal order: the first element in slot 0, the last in
+  *   slot `size() - 1`, so walking the list is a forward scan again, capacity is kept,
+  *   iterators are invalidated
+  * @complexity O(size)
+  */
+  constexpr
+  auto compact()
+      -> void
+  {
+    if ( this->is_empty() ) { this->clear(); return; }
+    this->relocate(this->m_storage.capacity(), true);
+  }
+}; // end of class Index_list_
+
+namespace pmr {
+  /// @brief `Index_list_` taking its slot array from a `std::pmr::memory_resource`
+  template <typename T, error_policy Policy = policy::Apologize>
+  using Index_list_ = ::Index_list_<T, std::pmr::polymorphic_allocator<T>, Policy>;
+} // namespace pmr
+
+#endif // INDEX_LIST_HPP
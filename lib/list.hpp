@@ -1,978 +1,1961 @@
-/**
-* @file list.hpp
-* @author yahya mohammed ( goldroger.1993@outlook.com )
-* @brief a double linked list with modern c++
-* @date 2021-06-02 ("date started")
-*/
-
-#ifndef LIST_HPP
-#define LIST_HPP
-
-#define XORSWAP(a, b) ((a) ^= (b), (b) ^= (a), (a) ^= (b))
-#define MYSWAP(a, b) (&(a) == &b) ? a : XORSWAP(a, b)
-
-#include <initializer_list>
-#include <iostream>
-#include <memory>
-#include "apology.hpp"
-
-
-template <typename T>
-class List_
-{
-  class Node {
-  public:
-    T m_data = {};
-    std::shared_ptr<Node> m_next = {nullptr};
-    Node *m_prev = {nullptr};
-  }; // end of class Node
-
-private:
-
-  using sh_ptr = std::shared_ptr<Node>;
-  constexpr sh_ptr allocate_node() const noexcept { return std::make_shared<Node>(); }
-
-  sh_ptr      m_head = {nullptr};
-  sh_ptr      m_tail = {nullptr};
-  std::size_t m_size = {};
-
-protected:
-  T _failed_ = {};
-
-private:
-
-  class iterator {
-  private:
-    Node *node_ptr {nullptr};
-  public:
-    constexpr iterator(const sh_ptr& newPtr)  : node_ptr(newPtr.get()) {}
-    constexpr iterator(sh_ptr&& newPtr)  : node_ptr(newPtr.get()) {}
-    constexpr iterator(const Node *& newPtr)  : node_ptr(newPtr) {}
-    constexpr iterator(Node && newPtr)  : node_ptr(newPtr) {}
-    constexpr iterator(const std::nullptr_t newPtr) : node_ptr(newPtr) {}
-    //
-    constexpr bool operator!=(const iterator& rhs) const {
-      return node_ptr != rhs.node_ptr;
-    }
-    //
-    constexpr T& operator*() const {
-      return node_ptr->m_data;
-    }
-    // pre increment
-    constexpr iterator operator++() {
-      node_ptr = node_ptr->m_next.get();
-      return *this;
-    }
-    // pre decrement
-    constexpr iterator operator--() {
-      node_ptr = node_ptr->m_prev;
-      return *this;
-    }
-    // post increment
-    constexpr iterator operator++(int) {
-      node_ptr = node_ptr->m_next.get();
-      return *this;
-    }
-  }; // end of class iterator
-
-public:
-
-  [[nodiscard]] constexpr auto begin()  const noexcept -> iterator { return iterator(m_head); }
-  [[nodiscard]] constexpr auto end()    const noexcept -> iterator { return iterator(nullptr); }
-  [[nodiscard]] constexpr auto begin() noexcept -> iterator { return iterator(m_head); }
-  //
-  [[nodiscard]] constexpr auto rbegin()  const noexcept -> iterator { return iterator(m_tail); }
-  [[nodiscard]] constexpr auto rend()    const noexcept -> iterator { return iterator(nullptr); }
-  [[nodiscard]] constexpr auto rbegin()  noexcept -> iterator { return iterator(m_tail); }
-
-  /* constructors */
-  constexpr List_() noexcept {
-    m_head    = nullptr;
-    m_tail    = nullptr;
-    m_size    = 0;
-  }
-  //
-  explicit constexpr List_(List_<T> && rhs) noexcept
-    : m_head(nullptr), m_tail(nullptr), m_size(0) {
-    m_head = rhs.m_head;
-    m_tail = rhs.m_tail;
-    m_size = rhs.m_size;
-    //
-    rhs.m_tail.reset();
-    rhs.m_head.reset();
-    rhs.m_size = {};
-  }
-  //
-  explicit constexpr List_(const List_<T>& rhs) noexcept {
-    m_head = rhs.m_head;
-    m_tail = rhs.m_tail;
-    m_size = rhs.m_size;
-  }
-
-  //
-  template<typename ...args>
-  explicit constexpr List_(const args& ...arg) {
-    (push_back(arg),...);
-  }
-
-  //
-  template<typename ...args>
-  explicit constexpr List_(args&& ...arg) {
-    (push_back(arg),...);
-  }
-
-  //
-  explicit constexpr List_(std::initializer_list<T> &&arg) {
-    for (auto &&i : arg) { push_back(i); }
-  }
-
-  //
-  explicit constexpr List_(const std::initializer_list<T> &arg) {
-    for (const auto &i : arg) { push_back(i); }
-  }
-
-  //
-  constexpr List_<T>& operator=(const List_<T>& rhs) noexcept {
-    if (this != &rhs) {
-      m_head = rhs.m_head;
-      m_tail = rhs.m_tail;
-      m_size = rhs.m_size;
-    }
-    return *this;
-  }
-
-  //
-  constexpr List_<T>& operator=(List_<T>&& rhs) noexcept {
-    if (this != &rhs) {
-      m_head = rhs.m_head;
-      m_tail = rhs.m_tail;
-      m_size = rhs.m_size;
-      //
-      rhs.m_tail = {nullptr};
-      rhs.m_head = {nullptr};
-      rhs.m_size = {};
-    }
-    return *this;
-  }
-
-  /*@ methods: */
-  /**
-  * @brief check if list is empty
-  * @complexity O(1)
-  * @return true
-  * @return false
-  */
-  [[nodiscard]] constexpr auto is_empty()
-      const noexcept -> bool
-  {
-    return m_head == nullptr;
-  }
-
-  /**
-  * @brief returns size of the list
-  * @complexity O(1)
-  * @return std::size_t
-  */
-  [[nodiscard]]
-  constexpr
-  auto size() const noexcept 
-      -> std::size_t { return m_size; }
-
-  /**
-  * @brief returns first element
-  * @complexity O(1)
-  * @return T&
-  */
-  [[nodiscard]]
-  constexpr
-  auto front()
-      -> T &
-  {
-    if (is_empty())  { show( Apology::empty ); return _failed_; }
-    return m_head->m_data;
-  }
-
-  /**
-  * @brief return last element&
-  * @complexity O(1)
-  * @return T&
-  */
-  [[nodiscard]]
-  constexpr
-  auto back()
-      -> T &
-  {
-    if (is_empty())  { show( Apology::empty ); return _failed_;}
-    return m_tail->m_data;
-  }
-
-  /**
-  * @brief return last element&
-  * @complexity O(1)
-  * @return T&
-  */
-  [[nodiscard]]
-  constexpr 
-  auto back() const
-      -> T
-  {
-    if (is_empty())  { show( Apology::empty ); return _failed_;}
-    return m_tail->m_data;
-  }
-
-  /**
-   * @brief prints the list in both `forward and backword`
-   *
-   * @param order `true` for forward `false` for backword
-   * @param delimiter
-   */
-  constexpr
-  auto print(const bool order = true, const char delimiter = ' ')
-      const -> void
-  {
-    if (is_empty())   { show( Apology::empty ); return; }
-            if ( order ) {
-      for ( auto&& i : *this ) { std::cout << i << ' '; }
-      std::cout << delimiter;
-      return;
-    }
-    for ( auto i = rbegin(); i != rend(); --i ) {
-      std::cout << *i << ' ';
-    }
-    std::cout << delimiter;
-  }
-
-  /**
-  * @brief return element at given position&
-  * @complexity O(n)
-  * @param times
-  * @return auto&
-  */
-  [[nodiscard]]
- constexpr
-  auto at(const std::size_t& pos)
-      -> auto &
-  {
-    if (is_empty()) { show( Apology::empty ); return _failed_;}
-    if (pos < 0 || pos > m_size-1) {
-      show( Apology::invalid_position );
-      return _failed_;
-    }
-    auto it = begin();
-    for (std::size_t i = 0; i < pos; ++i) { ++it; }
-    return (*it);
-  }
-
-  [[nodiscard]]
-  constexpr
-  auto at(const std::size_t& pos) const
-      -> auto
-  {
-    if (is_empty()) { show( Apology::empty ); return _failed_;}
-    if (pos < 0 || pos > m_size-1) {
-      show( Apology::invalid_position );
-      return _failed_;
-    }
-    auto it = begin();
-    for (std::size_t i = 0; i < pos; ++i) { ++it; }
-    return (*it);
-  }
-
-  [[nodiscard]]
-  constexpr
-  auto at(const sh_ptr& ptr) const
-      -> auto &
-  {
-    return ptr->m_data;
-  }
-
-  /**
-  * @brief add element at end of list
-  * @complexity O(1)
-  * @param arg
-  */
-  constexpr
-  auto push_back(T &&arg)
-      -> void
-  {
-    sh_ptr new_node   = allocate_node();
-    new_node->m_data  = arg;
-    new_node->m_next  = nullptr;
-    //
-    if ( is_empty() )  {
-      m_head = new_node; // |null,arg, null|
-      m_tail = new_node; // |null,arg, null|
-    } else {
-      m_tail->m_next = new_node; // changes head-> next too, then it changes
-      // the previous temps next
-      // head ->|null,0, 0x1| <-> |0x77,1, 0x3| <-> |0x88,2, null|
-      new_node->m_prev = m_tail.get();
-    }
-    m_tail = new_node; // now tail points to temp
-    //
-    if ( m_head->m_prev != nullptr ) {
-      m_head->m_prev = nullptr;
-    }
-    //
-    ++m_size;
-  }
-
-  /**
-  * @brief add element at end of list
-  * @complexity O(1)
-  * @param arg
-  */
-  constexpr
-  auto push_back(const T &arg)
-      -> void
-  {
-    sh_ptr new_node   = allocate_node();
-    new_node->m_data  = arg;
-    new_node->m_next  = nullptr;
-    //
-    if ( is_empty() )  {
-      m_head = new_node; // |null,arg, null|
-      m_tail = new_node; // |null,arg, null|
-    } else {
-      m_tail->m_next = new_node; // changes head-> next too, then it changes
-      // the previous temps next
-      // head ->|null,0, 0x1| <-> |0x77,1, 0x3| <-> |0x88,2, null|
-      new_node->m_prev = m_tail.get();
-    }
-    m_tail = new_node; // now tail points to temp
-    //
-    if ( m_head->m_prev != nullptr ) {
-      m_head->m_prev = nullptr;
-    }
-    //
-    ++m_size;
-  }
-
-  //
-  template<typename ...args>
-  constexpr auto push_back(const args&...arg)
-      -> void
-  {
-    (push_back(arg),...);
-  }
-
-  /**
-  * @brief add element at the beginning of list
-  * @complexity O(1)
-  * @param arg
-  */
-   constexpr
-  auto push_front(const T &arg)
-      -> void
-  {
-    if ( is_empty() ) { push_back(arg); return; }
-    sh_ptr new_node   = allocate_node();
-    m_head->m_prev    = new_node; // linking head to old head // head -> |old head, arg, next|
-    //
-    new_node->m_data  = arg;
-    new_node->m_next  = m_head;
-    m_head = new_node; // m_head is new_head now
-    m_head->m_prev    = nullptr;
-    //
-    ++m_size;
-  }
-
-  /**
-  * @brief add element at the beginning of list
-  * @complexity O(1)
-  * @param arg
-  */
-  constexpr
-  auto push_front(T &&arg)
-      -> void
-  {
-    if ( is_empty() ) { push_back(arg); return; }
-    sh_ptr new_node   = allocate_node();
-    m_head->m_prev    = new_node.get(); // linking head to new head // head -> |new head, arg, next|
-    //
-    new_node->m_data  = arg;
-    new_node->m_next  = m_head;
-    m_head = new_node; // m_head is new_head now
-    m_head->m_prev    = nullptr;
-    //
-    ++m_size;
-  }
-
-  //
-  constexpr
-  auto push_front(const auto& ...arg)
-      -> void
-  {
-    (push_front(arg), ...);
-  }
-
-  /**
-  * @brief add element at given position
-  * @complexity O(n)
-  * @param pos
-  * @param arg
-  */
-  constexpr
-  auto push_at(const std::size_t pos, const T &arg)
-      -> void
-  {
-    if (pos < 0 || pos >= m_size) {
-      show( Apology::invalid_position ); return;
-    }
-    if (pos == 0)                 { push_front(arg); return; }
-    if (pos == m_size-1)          {push_back(arg); return; }
-    /* adding nodes between previous and next */
-    sh_ptr prev_node  = nullptr; // hold previous node
-    sh_ptr new_node   = allocate_node(); // hold new node
-    sh_ptr next_node  = m_head; // points to next node
-    //
-    for (std::size_t i = 0; i < pos; ++i) {
-      prev_node = next_node;
-      next_node = next_node->m_next;
-    }
-    new_node->m_data  = arg;
-    /// @link:
-    prev_node->m_next = new_node;
-    new_node->m_next  = next_node;
-
-    new_node->m_prev  = prev_node;
-    next_node->m_prev = new_node;
-    //
-    ++m_size;
-  }
-
-  constexpr
-  auto push_at(std::size_t &&pos, T &&arg)
-      -> void
-  {
-    if (pos < 0 || pos >= m_size) {
-      show( Apology::invalid_position ); return;
-    }
-    if (pos == 0)                 { push_front(arg); return; }
-    if (pos == m_size-1)          {push_back(arg); return; }
-    /* adding nodes between previous and next */
-    sh_ptr prev_node  = nullptr; // hold previous node
-    sh_ptr new_node   = allocate_node(); // hold new node
-    sh_ptr next_node  = m_head; // points to next node
-    //
-    for (std::size_t i = 0; i < pos; ++i) {
-      prev_node = next_node;
-      next_node = next_node->m_next;
-    }
-    new_node->m_data  = arg;
-    /// @link:
-    prev_node->m_next = new_node;
-    new_node->m_next  = next_node;
-
-    new_node->m_prev  = prev_node;
-    next_node->m_prev = new_node;
-    //
-    ++m_size;
-  }
-
-  /**
-  * @brief add element at after given position
-  * @complexity O(n)
-  * @param pos
-  * @param arg
-  */
-  constexpr
-  auto push_after_at(const std::size_t pos, const T &arg)
-      -> void
-  {
-    if (pos < 0 || pos >= m_size) {
-      show( Apology::invalid_position ); return;
-    }
-    if (pos == 0)                 { push_front(arg); return; }
-    if (pos == m_size-1)          {push_back(arg); return; }
-    /* adding nodes between previous and next */
-    sh_ptr prev_node  = nullptr; // hold previous node
-    sh_ptr new_node   = allocate_node(); // hold new node
-    sh_ptr next_node  = m_head; // points to next node
-    //
-    for (std::size_t i = 0; i < pos+1; ++i) {
-      prev_node = next_node;
-      next_node = next_node->m_next;
-    }
-    new_node->m_data  = arg;
-    /// @link:
-    prev_node->m_next = new_node;
-    new_node->m_next  = next_node;
-
-    new_node->m_prev  = prev_node;
-    next_node->m_prev = new_node;
-    //
-    ++m_size;
-  }
-
-  /**
-  * @brief add element at after given position
-  * @complexity O(n)
-  * @param pos
-  * @param arg
-  */
-  constexpr
-  auto push_after_at(std::size_t &&pos,  T &&arg)
-      -> void
-  {
-    if (pos < 0 || pos >= m_size) {
-      show( Apology::invalid_position ); return;
-    }
-    if (pos == 0)                 { push_front(arg); return; }
-    if (pos == m_size-1)          {push_back(arg); return; }
-    /* adding nodes between previous and next */
-    sh_ptr prev_node  = nullptr; // hold previous node
-    sh_ptr new_node   = allocate_node(); // hold new node
-    sh_ptr next_node  = m_head; // points to next node
-    //
-    for (std::size_t i = 0; i < pos+1; ++i) {
-      prev_node = next_node;
-      next_node = next_node->m_next;
-    }
-    new_node->m_data  = arg;
-    /// @link:
-    prev_node->m_next = new_node;
-    new_node->m_next  = next_node;
-
-    new_node->m_prev  = prev_node;
-    next_node->m_prev = new_node;
-    //
-    ++m_size;
-  }
-
-  /**
-  * @brief adds value after specific location
-  * @param after : the value you want add value after it
-  * @param val : the value
-  */
-  constexpr
-  auto push_after_value(T&& after, T&& val)
-      -> void
-  {
-    if (after == at(m_tail)) { push_back(val); return; }
-    sh_ptr it = {m_head};
-    while ( at(it) != after) {
-      if (it->m_next == nullptr) {
-        show( Apology::not_found );
-        return;
-      }
-      it = it->m_next;
-    }
-    //
-    sh_ptr new_node = allocate_node();
-    new_node->m_data = val; // add data to new_node
-    /// @link:
-    new_node->m_next = it->m_next; // new_node's next now pointing at what it's next is
-    it->m_next = new_node; // it's next points to new_node
-    new_node->m_prev = it;
-    //
-    new_node->m_next->m_prev = new_node;
-    ++m_size;
-  }
-
-  constexpr
-  auto push_after_value(const T& after, const T& val)
-      -> void
-  {
-    if (after == at(m_tail)) { push_back(val); return; }
-    sh_ptr it = {m_head};
-    while ( at(it) != after) {
-      if (it->m_next == nullptr) {
-        show( Apology::not_found );
-        return;
-      }
-      it = it->m_next;
-    }
-    // 1 2 3 4
-    sh_ptr new_node = allocate_node();
-    new_node->m_data = val; // add data to new_node
-    /// @link:
-    new_node->m_next = it->m_next; // new_node's next now points at what it's next is
-    it->m_next = new_node; // it's next points to new_node
-    new_node->m_prev = it;
-    //
-    new_node->m_next->m_prev = new_node;
-    ++m_size;
-  }
-
-  /**
-  * @brief adds value before specific location
-  * @param before : the value you want add value before it
-  * @param val : the value
-  */
-  constexpr
-  auto push_before_value(T&& before, T&& val)
-      -> void
-  {
-    if (before == at(m_head)) { push_front(val); return; }
-    sh_ptr it = {m_head};
-    while ( at(it) != before) {
-      if (it->m_next == nullptr) {
-        show( Apology::not_found );
-        return;
-      }
-      it = it->m_next;
-    }
-    //
-    sh_ptr new_node = allocate_node();
-    new_node->m_data = val; // add data to new_node
-    /// @link:
-    new_node->m_prev = it->m_prev;
-    it->m_prev = new_node;
-    new_node->m_next = it; // new_node is now pointing to `it`
-    new_node->m_prev->m_next = new_node;
-    //
-    ++m_size;
-  }
-
-  constexpr
-  auto push_before_value(const T& before, const T& val)
-      -> void
-  {
-    if (before == at(m_head)) { push_front(val); return; }
-    sh_ptr it = {m_head};
-    while ( at(it) != before) {
-      if (it->m_next == nullptr) {
-         show( Apology::not_found );
-        return;
-      }
-      it = it->m_next;
-    }
-    //
-    sh_ptr new_node = allocate_node();
-    new_node->m_data = val; // add data to new_node
-    /// @link:
-    new_node->m_prev = it->m_prev;
-    it->m_prev = new_node;
-    new_node->m_next = it; // new_node is now pointing to `it`
-    new_node->m_prev->m_next = new_node;
-    //
-    ++m_size;
-  }
-  /// @brief pop certain value/s from list
-  constexpr
-  auto pop_value(T&& val)
-      -> void
-  {
-    if ( is_empty() ) { show( Apology::empty ); return; }
-    //
-    auto it = begin();
-    std::size_t count {0};
-    //
-    while ( it != end() ) {
-      if ( *it == val ) {
-        pop_at(count);
-        count = 0;
-      }
-      ++count;
-      ++it;
-    }
-  }
-
-  /**
-  * @brief remove last element
-  * @complexity O(n)
-  */
-  constexpr
-  auto pop_back()
-      -> void
-  {
-    if (is_empty())  { show( Apology::empty ); return; }
-    if (m_size == 1) { m_head.reset(); return; } // if one node created
-    //
-    sh_ptr last   = m_tail; //  holding the tail `old tail` to be deleted
-    sh_ptr temp   = last->m_prev->m_prev; // holding `prev -> prev` before losing data
-    //
-    m_tail = m_tail->m_prev; // new tails = prev of tail
-    m_tail->m_next = nullptr; // new tails next = null;
-    m_tail->m_prev = temp; // new tails prev = last->prev->prev
-
-    last.reset();
-    --m_size;
-  }
-
-  /**
-  * @brief remove first element
-  * @complexity O(1)
-  */
-  constexpr
-  auto pop_front()
-      -> void
-  {
-    if (is_empty())   { show( Apology::empty ); return; }
-    if (m_size == 1)  { m_head.reset(); return; } // if one node created
-    //
-    sh_ptr first  = {m_head}; // first points to old head
-    m_head        = m_head->m_next; // head points to one step ahead of old head
-    m_head->m_prev = nullptr;
-    //
-    --m_size;
-    first.reset();
-  }
-
-  /**
-  * @brief remove element at given position
-  * @complexity O(n)
-  */
-  constexpr
-  auto pop_at(const std::size_t& pos)
-      -> void
-  {
-    if (pos < 0 || pos >= m_size) { show( Apology::invalid_position); return; }
-    if (is_empty())               { show( Apology::empty ); return; }
-    if (pos == 0)                 { pop_front(); return; }
-    else if ( pos == m_size-1)    { pop_back(); return; }
-    //
-    sh_ptr prev = nullptr;
-    sh_ptr next = m_head;
-    // ex: 0, 1, 2, 3, 4, 5 : pop_at(1) now:
-    sh_ptr mid   = m_head;
-    for (std::size_t i = 0; i < pos && next != nullptr; ++i) {
-      prev  = mid;                 // 0
-      next  = mid->m_next->m_next; // 2
-      mid   = mid->m_next;         // 1
-    }
-    prev->m_next = next; // 0 -> 2 -> 3 -> 4 -> 5 and whatever was node 1, is now gone
-    next->m_prev = prev;
-    --m_size;
-    //
-    mid = nullptr; // 1 -> nullptr
-  }
-
-  /**
-  * @brief remove element at given position
-  * @complexity O(n)
-  */
-  constexpr
-  auto pop_at(std::size_t&& pos)
-      -> void
-  {
-    if (pos < 0 || pos >= m_size) { show( Apology::invalid_position); return; }
-    if (is_empty())               { show( Apology::empty ); return; }
-    if (pos == 0)                 { pop_front(); return; }
-    else if ( pos == m_size-1)    { pop_back(); return; }
-    //
-    sh_ptr prev = nullptr;
-    sh_ptr next = m_head;
-    // ex: 0, 1, 2, 3, 4, 5 : pop_at(1) now:
-    sh_ptr mid   = m_head;
-    for (std::size_t i = 0; i < pos && next != nullptr; ++i) {
-      prev  = mid;                 // 0
-      next  = mid->m_next->m_next; // 2
-      mid   = mid->m_next;         // 1
-    }
-    prev->m_next = next; // 0 -> 2 -> 3 -> 4 -> 5 and whatever was node 1, is now gone
-    next->m_prev = prev;
-    --m_size;
-    //
-    mid = nullptr; // 1 -> nullptr
-  }
-
-  /// @brief pops duplicates from the list
-  constexpr
-  auto pop_duplicates()
-      -> void
-  {
-    sort();
-    if (is_empty()) { show( Apology::empty ); return; }
-    //
-    sh_ptr it = m_head;
-    while( it->m_next != nullptr ) {
-      if ( at(it) == at(it->m_next) ) {
-        MYSWAP(at(it), back());
-      }
-      pop_back();
-      it = it->m_next;
-    }
-  }
-
-  /**
-  * @brief splitiing the current list into two lists
-  * @complexity O(n)
-  * @param l1
-  * @param l2
-  */
-  auto split(List_<T> &l1, List_<T> &l2) -> void // note: not tes
-  {
-    if (is_empty())  { show( Apology::empty ); return; }
-    const auto& s   = size();
-    sh_ptr      it  = { m_head };
-    for (std::size_t i = 0; i < (s/2); ++i, it = it->m_next) {
-      l1.push_back( at(it) );
-    }
-    for ( std::size_t i = (s/2); i < s; ++i , it = it->m_next) {
-      l2.push_back( at(it) );
-    }
-  }
-
-  /**
-  * @brief merges two lists into one
-  * @complexity O(n)
-  * @param l1
-  * @param l2
-  */
-  auto merge( List_<T>& l1,  List_<T>& l2) -> void // note: not tested
-  {
-    if (l1.is_empty())  { show( Apology::empty ); return; }
-    if (l2.is_empty())  { show( Apology::empty ); return; }
-    for ( const auto& i : l1 ) { push_back(i); }
-    for ( const auto& i : l2 ) { push_back(i); }
-  }
-
-  /**
-  * @brief: sorts element in ASC order by default, put `true` for DESC
-  * @complexity  O(n^2)
-  */
-  constexpr
-  auto sort(const bool desc = false) const
-      -> void
-  {
-    if (is_empty()) { show( Apology::empty ); return; }
-    bool sorted   = true;
-    sh_ptr curr   = {};
-    sh_ptr next   = {};
-    //
-    if ( !desc )  {
-      while ( sorted ) {
-        sorted   = false;
-        curr     = m_head;
-        while ( curr->m_next != nullptr ) {
-          next = curr->m_next;
-          if ( at(curr) > at(next) ) {
-            MYSWAP(at(next), at(curr));
-            sorted = true;
-          }
-          curr = curr->m_next;
-        }
-      }
-    } else {
-      while ( sorted ) {
-        sorted   = false;
-        curr     = {m_head};
-        while (curr->m_next != nullptr) {
-          next = curr->m_next;
-          if ( at(curr) < at(next) ) {
-            MYSWAP(at(curr), at(next));
-            sorted = true;
-          }
-          curr = curr->m_next;
-        }
-      }
-    }
-  }
-
-  /**
-  * @brief check if the list is sorted ASC
-  * @complexity O(n)
-  */
-  [[nodiscard]]
-  constexpr
-  auto is_sorted() const
-      -> bool
-  {
-    if ( is_empty() )  { show( Apology::empty ); return false; }
-    bool check  = false;
-    sh_ptr it   = {m_head};
-    while ( it->m_next != nullptr ) {
-      if ( at(it->m_next) >= at(it) ) { check = true; }
-      else {
-        check = false;
-        break;
-      }
-      it = it->m_next;
-    }
-    return check;
-  }
-
-  /**
-  * @brief search for a value
-  * @complexity O(n)
-  * @param target
-  */
-  [[nodiscard]]
-  constexpr
-  auto search(const T &target) const
-      -> bool
-  {
-    if (is_empty())  { show( Apology::empty ); return false; }
-    for (const auto& i : *this) {
-      if ( i == target ) { return true; }
-    }
-    return false;
-  }
-
-  /**
-  * @brief search for a value
-  * @complexity O(n)
-  * @param target
-  */
-  [[nodiscard]]
-  constexpr
-  auto search(T &&target) const
-      -> bool
-  {
-    if (is_empty())  { show( Apology::empty ); return false; }
-    for (auto &&i : *this) {
-      if ( i == target ) { return true; }
-    }
-    return false;
-  }
-
-  /**
-  * @brief returns the location of that node containing target, count from the right to left
-  * @complexity O(n)
-  * @param target
-  * @return std::int64_t
-  */
-  [[nodiscard]]
-  constexpr
-  auto locate(const T& target) const
-      -> std::int64_t
-  {
-    if (is_empty())  { show( Apology::empty ); return -1; }
-    for (std::int64_t j = 0; const auto& i : *this ) {
-      if ( i == target ) { return j; }
-      ++j;
-    }
-    return -1;
-  }
-
-  /**
-  * @brief returns the location of that node containing target, count from the right to left
-  * @complexity O(n)
-  * @param target
-  * @return std::int64_t
-  */
-  [[nodiscard]]
-  constexpr
-  auto locate(T &&target) const
-      -> std::int64_t
-  {
-    if (is_empty())  { show( Apology::empty ); return -1; }
-    for (std::int64_t j = 0;  auto &&i : *this ) {
-      if ( i == target ) { return j; }
-      ++j;
-    }
-    return -1;
-  }
-
-  /**
-  * @brief erases the list
-  * @complexity O(n)
-  */
-  constexpr
-  auto clear()
-      -> void
-  {
-    if (is_empty())  { show( Apology::empty ); return; }
-    Node *it;
-    while ( m_tail != nullptr ) {
-      it = m_tail->m_prev;
-      m_tail->m_next = nullptr;
-      m_tail->m_prev = nullptr;
-      m_tail = sh_ptr(it);
-    }
-  }
-}; // end of class List_<T>
-
-#endif // LIST_HPP
+/**
+* @file list.hpp
+* @author yahya mohammed ( goldroger.1993@outlook.com )
+* @brief a double linked list with modern c++
+* @date 2021-06-02 ("date started")
+*/
+
+#ifndef LIST_HPP
+#define LIST_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <ostream>
+#include <ranges>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include "apology.hpp"
+#include "pool.hpp"
+#include "serial.hpp"
+#include "stats.hpp"
+#ifdef LIST_IOSTREAM
+#include <iostream>
+#endif
+
+
+/// @brief picks the range constructor of `List_`, like C++23 `std::from_range`
+struct from_range_t { explicit from_range_t() = default; };
+inline constexpr from_range_t from_range{};
+
+/**
+* @tparam T element type
+* @tparam Alloc allocator used for the nodes, rebound to the node type internally,
+*   use `pmr::List_` together with `Node_pool` ( "pool.hpp" ) to pool nodes
+* @tparam Policy what happens on misuse ( empty list, bad position, ... ), see `policy`,
+*   `policy::Unchecked` drops every check so hot accessors are a bare pointer chase
+* @tparam Stats `stats::Count` to count allocations, walked nodes and calls, see `counters()`,
+*   the default `stats::None` costs nothing
+*/
+template <typename T, typename Alloc = std::allocator<T>, error_policy Policy = policy::Apologize,
+          stats_policy Stats = stats::None>
+class List_ : protected detail::Failed_slot_for<T, Policy>
+{
+  class Node {
+  public:
+    T m_data;
+    Node *m_next = {nullptr};
+    Node *m_prev = {nullptr};
+    //
+    template <typename ...Args>
+    constexpr explicit Node(Args&& ...args) : m_data(std::forward<Args>(args)...) {}
+  }; // end of class Node
+
+private:
+
+  using node_allocator  = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits     = std::allocator_traits<node_allocator>;
+
+  Node       *m_head = {nullptr};
+  Node       *m_tail = {nullptr};
+  std::size_t m_size = {};
+  [[no_unique_address]] node_allocator m_alloc = {};
+  // last node reached by index and its position, null when unknown, only non const lookups
+  // move it so const ones can run on several threads at once
+  Node       *m_cursor     = {nullptr};
+  std::size_t m_cursor_pos = {};
+  [[no_unique_address]] mutable Stats m_stats = {};
+
+  /// @brief the cached cursor
+  [[nodiscard]]
+  constexpr
+  auto cursor() const
+      noexcept -> Node *
+  {
+    return m_cursor;
+  }
+
+  /// @brief allocates a node and constructs its data from `args`
+  template <typename ...Args>
+  constexpr
+  auto create_node(Args&& ...args)
+      -> Node *
+  {
+    Node *node = node_traits::allocate(m_alloc, 1);
+    try {
+      node_traits::construct(m_alloc, node, std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(m_alloc, node, 1);
+      throw;
+    }
+    m_stats.allocated(sizeof(Node));
+    return node;
+  }
+
+  /// @brief destroys the data of `node` and gives its memory back
+  constexpr
+  auto destroy_node(Node *node)
+      noexcept -> void
+  {
+    node_traits::destroy(m_alloc, node);
+    node_traits::deallocate(m_alloc, node, 1);
+    m_stats.freed(sizeof(Node));
+  }
+
+  /// @brief links `node` after the tail
+  constexpr
+  auto link_back(Node *node)
+      noexcept -> void
+  {
+    node->m_prev = m_tail;
+    node->m_next = nullptr;
+    if ( m_tail != nullptr ) { m_tail->m_next = node; }
+    else                     { m_head = node; }
+    m_tail = node;
+    ++m_size;
+  }
+
+  /// @brief links `node` before the head
+  constexpr
+  auto link_front(Node *node)
+      noexcept -> void
+  {
+    node->m_prev = nullptr;
+    node->m_next = m_head;
+    if ( m_head != nullptr ) { m_head->m_prev = node; }
+    else                     { m_tail = node; }
+    m_head = node;
+    ++m_size;
+    if ( cursor() != nullptr ) { ++m_cursor_pos; }
+  }
+
+  /// @brief links `node` between `prev` and `next`, neither may be null
+  constexpr
+  auto link_between(Node *prev, Node *node, Node *next)
+      noexcept -> void
+  {
+    node->m_prev = prev;
+    node->m_next = next;
+    prev->m_next = node;
+    next->m_prev = node;
+    ++m_size;
+    Node *cur = cursor();
+    if ( next == cur )       { ++m_cursor_pos; }
+    else if ( prev != cur )  { m_cursor = nullptr; }
+  }
+
+  /// @brief links `node` before `pos`, a null `pos` means after the tail
+  constexpr
+  auto link_before(Node *pos, Node *node)
+      noexcept -> void
+  {
+    if ( pos == nullptr )     { link_back(node); }
+    else if ( pos == m_head ) { link_front(node); }
+    else                      { link_between(pos->m_prev, node, pos); }
+  }
+
+  /// @brief unlinks `node` from the chain and destroys it
+  constexpr
+  auto unlink(Node *node)
+      noexcept -> void
+  {
+    if ( Node *cur = cursor(); cur == node ) { // keep the position, step onto a neighbour
+      if ( node->m_next != nullptr ) { m_cursor = node->m_next; }
+      else                           { m_cursor = node->m_prev; --m_cursor_pos; }
+    } else if ( cur == nullptr ) {
+      // nothing cached
+    } else if ( node == m_head || node->m_next == cur ) {
+      --m_cursor_pos;
+    } else if ( node != m_tail && node->m_prev != cur ) {
+      m_cursor = nullptr;
+    }
+    if ( node->m_prev != nullptr ) { node->m_prev->m_next = node->m_next; }
+    else                           { m_head = node->m_next; }
+    if ( node->m_next != nullptr ) { node->m_next->m_prev = node->m_prev; }
+    else                           { m_tail = node->m_prev; }
+    destroy_node(node);
+    --m_size;
+  }
+
+  /// @brief links the detached chain [first, last] of `n` nodes before `pos`, a null `pos` means after the tail
+  constexpr
+  auto link_chain(Node *pos, Node *first, Node *last, const std::size_t n)
+      noexcept -> void
+  {
+    Node *prev    = ( pos != nullptr ) ? pos->m_prev : m_tail;
+    first->m_prev = prev;
+    last->m_next  = pos;
+    if ( prev != nullptr ) { prev->m_next = first; }
+    else                   { m_head = first; }
+    if ( pos != nullptr )  { pos->m_prev = last; }
+    else                   { m_tail = last; }
+    m_size += n;
+    if ( cursor() == nullptr )  { return; }
+    if ( prev == nullptr )      { m_cursor_pos += n; }
+    else if ( pos != nullptr )  { m_cursor = nullptr; }
+  }
+
+  /// @brief detaches the chain [first, last] of `n` nodes without destroying them
+  constexpr
+  auto unlink_chain(Node *first, Node *last, const std::size_t n)
+      noexcept -> void
+  {
+    if ( first->m_prev != nullptr ) { first->m_prev->m_next = last->m_next; }
+    else                            { m_head = last->m_next; }
+    if ( last->m_next != nullptr )  { last->m_next->m_prev = first->m_prev; }
+    else                            { m_tail = first->m_prev; }
+    first->m_prev = nullptr;
+    last->m_next  = nullptr;
+    m_size       -= n;
+    m_cursor      = nullptr;
+  }
+
+  /// @brief number of nodes from `node` to the tail, walks from both ends of that span at once
+  [[nodiscard]]
+  constexpr
+  auto count_to_end(const Node *node)
+      const noexcept -> std::size_t
+  {
+    const Node *ahead = node;   // runs to the tail
+    const Node *behind = m_head; // runs to `node`
+    for (std::size_t i = 0; ; ++i, ahead = ahead->m_next, behind = behind->m_next) {
+      if ( ahead == nullptr ) { return i; }
+      if ( behind == node )   { return m_size - i; }
+    }
+  }
+
+  /// @brief true when nodes of `other` can be relinked into this list and freed by it
+  [[nodiscard]]
+  constexpr
+  auto shares_allocator(const List_& other)
+      const noexcept -> bool
+  {
+    if constexpr ( node_traits::is_always_equal::value ) { return true; }
+    else                                                 { return m_alloc == other.m_alloc; }
+  }
+
+  /// @brief moves the elements of [first, last) of `other` before `pos` one by one, for unequal allocators
+  constexpr
+  auto transfer(Node *pos, List_& other, Node *first, Node *last)
+      -> void
+  {
+    while ( first != last ) {
+      Node *next = first->m_next;
+      link_before(pos, create_node(std::move(first->m_data)));
+      other.unlink(first);
+      first = next;
+    }
+  }
+
+  /**
+  * @brief returns the node at `pos`, `pos` must be valid,
+  *   walks from the head, the tail or the cached cursor, whichever is closest, leaves the cursor alone
+  */
+  [[nodiscard]]
+  constexpr
+  auto node_at(const std::size_t pos)
+      const noexcept -> Node *
+  {
+    Node        *it   = m_head;
+    std::size_t  from = 0;
+    std::size_t  dist = pos;
+    if ( m_size - 1 - pos < dist ) {
+      it    = m_tail;
+      from  = m_size - 1;
+      dist  = m_size - 1 - pos;
+    }
+    if ( cursor() != nullptr ) {
+      const std::size_t to_cursor = pos > m_cursor_pos ? pos - m_cursor_pos : m_cursor_pos - pos;
+      if ( to_cursor < dist ) {
+        it    = m_cursor;
+        from  = m_cursor_pos;
+      }
+    }
+    m_stats.walked(pos > from ? pos - from : from - pos);
+    for (; from < pos; ++from) { it = it->m_next; }
+    for (; from > pos; --from) { it = it->m_prev; }
+    return it;
+  }
+
+  /// @brief `node_at` that also moves the cursor onto the node found
+  [[nodiscard]]
+  constexpr
+  auto seek(const std::size_t pos)
+      noexcept -> Node *
+  {
+    m_cursor      = node_at(pos);
+    m_cursor_pos  = pos;
+    return m_cursor;
+  }
+
+  /// @brief returns the first node holding `value` or null
+  [[nodiscard]]
+  constexpr
+  auto find_node(const T& value)
+      const -> Node *
+  {
+    std::size_t steps = 0;
+    for (Node *it = m_head; it != nullptr; it = it->m_next) {
+      ++steps;
+      if ( it->m_data == value ) { m_stats.walked(steps); return it; }
+    }
+    m_stats.walked(steps);
+    return nullptr;
+  }
+
+  /**
+  * @brief merges two sorted runs chained through `m_next` only,
+  *   on ties `first` wins so the merge is stable
+  */
+  template <typename Compare>
+  static
+  constexpr
+  auto merge_runs(Node *first, Node *second, Compare& comp)
+      -> Node *
+  {
+    Node  *head = nullptr;
+    Node **tail = &head;
+    while ( first != nullptr && second != nullptr ) {
+      if ( comp(second->m_data, first->m_data) ) { *tail = second; second = second->m_next; }
+      else                                       { *tail = first;  first  = first->m_next;  }
+      tail = &(*tail)->m_next;
+    }
+    *tail = ( first != nullptr ) ? first : second;
+    return head;
+  }
+
+  /// @brief rebuilds `m_next` from `m_prev` along the chain ending at `tail`, undoing merges that threw
+  static
+  constexpr
+  auto unmerge(Node *tail)
+      noexcept -> void
+  {
+    for (Node *next = nullptr; tail != nullptr; next = tail, tail = tail->m_prev) { tail->m_next = next; }
+  }
+
+  /// @brief makes `head` the chain of the list, restoring `m_prev` and `m_tail` from `m_next`
+  constexpr
+  auto relink(Node *head)
+      noexcept -> void
+  {
+    m_head      = head;
+    m_cursor    = nullptr;
+    Node *prev  = nullptr;
+    for (Node *it = head; it != nullptr; it = it->m_next) {
+      it->m_prev  = prev;
+      prev        = it;
+    }
+    m_tail = prev;
+  }
+
+  /// @brief destroys every node
+  constexpr
+  auto release()
+      noexcept -> void
+  {
+    while ( m_head != nullptr ) {
+      Node *next = m_head->m_next;
+      destroy_node(m_head);
+      m_head = next;
+    }
+    m_tail    = nullptr;
+    m_size    = 0;
+    m_cursor  = nullptr;
+  }
+
+  /// @brief writes the header and the elements through `sink`, see `serial.hpp`
+  template <typename Sink>
+  auto save_to(Sink sink) const
+      -> bool
+  {
+    const serial::Header header = serial::header_for<T>(m_size);
+    serial::Writer<Sink> out(sink);
+    out.put(&header, sizeof header);
+    for (Node *node = m_head; node != nullptr; node = node->m_next) {
+      if constexpr ( std::is_trivially_copyable_v<T> ) {
+        out.put(std::addressof(node->m_data), sizeof(T));
+      } else {
+        const std::uint64_t length = node->m_data.size();
+        out.put(&length, sizeof length);
+        out.put(node->m_data.data(), length * sizeof(typename T::value_type));
+      }
+    }
+    return out.flush();
+  }
+
+  /**
+  * @brief reads what `save_to` wrote through `source` into a detached chain, then swaps it in,
+  *   the list is untouched when the header does not match or the data runs short; the count
+  *   and the string lengths come from the file, so nodes are reserved and characters read one
+  *   bounded batch at a time and a lying header costs no more than one batch
+  */
+  template <typename Source>
+  auto load_from(Source source)
+      -> bool
+  {
+    serial::Header header;
+    if ( !source(&header, sizeof header) || !serial::matches<T>(header) ) { return false; }
+    Chain chain;
+    const auto drop = [&] { drop_chain(chain); return false; };
+    try {
+      if constexpr ( std::is_trivially_copyable_v<T> ) {
+        constexpr std::size_t batch = std::max<std::size_t>(1, serial::buffer_bytes / sizeof(T));
+        const auto buffer = std::make_unique_for_overwrite<std::byte[]>(batch * sizeof(T));
+        while ( chain.m_size < header.m_count ) {
+          const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(batch, header.m_count - chain.m_size));
+          if ( !source(buffer.get(), n * sizeof(T)) ) { return drop(); }
+          reserve_nodes(n);
+          for (std::size_t i = 0; i < n; ++i) {
+            std::array<std::byte, sizeof(T)> raw;
+            std::memcpy(raw.data(), buffer.get() + i * sizeof(T), sizeof(T));
+            chain.append(create_node(std::bit_cast<T>(raw)));
+          }
+        }
+      } else {
+        using char_type = typename T::value_type;
+        constexpr std::size_t batch = serial::buffer_bytes / sizeof(char_type);
+        constexpr std::size_t nodes = std::max<std::size_t>(1, serial::buffer_bytes / sizeof(Node));
+        while ( chain.m_size < header.m_count ) {
+          if ( chain.m_size % nodes == 0 ) {
+            reserve_nodes(static_cast<std::size_t>(std::min<std::uint64_t>(nodes, header.m_count - chain.m_size)));
+          }
+          std::uint64_t length = 0;
+          if ( !source(&length, sizeof length) ) { return drop(); }
+          T value;
+          if ( length > value.max_size() ) { return drop(); }
+          while ( value.size() < length ) {
+            const std::size_t have  = value.size();
+            const std::size_t n     = static_cast<std::size_t>(std::min<std::uint64_t>(batch, length - have));
+            value.resize(have + n);
+            if ( !source(value.data() + have, n * sizeof(char_type)) ) { return drop(); }
+          }
+          chain.append(create_node(std::move(value)));
+        }
+      }
+    } catch (...) {
+      drop();
+      throw;
+    }
+    release();
+    link(nullptr, chain);
+    return true;
+  }
+
+  /// @brief nodes built and linked to each other but not yet to the list, so a throwing element leaves the list alone
+  struct Chain {
+    Node       *m_first = {nullptr};
+    Node       *m_last  = {nullptr};
+    std::size_t m_size  = {};
+    //
+    constexpr auto append(Node *node) noexcept -> void {
+      node->m_prev = m_last;
+      if ( m_last != nullptr ) { m_last->m_next = node; }
+      else                     { m_first = node; }
+      m_last = node;
+      ++m_size;
+    }
+  }; // end of struct Chain
+
+  /// @brief destroys a chain that never got linked
+  constexpr
+  auto drop_chain(Chain& chain)
+      noexcept -> void
+  {
+    while ( chain.m_first != nullptr ) {
+      Node *next = chain.m_first->m_next;
+      destroy_node(chain.m_first);
+      chain.m_first = next;
+    }
+    chain = Chain{};
+  }
+
+  /// @brief asks a `Node_pool` behind a `pmr::List_` to carve the next `n` nodes from one block
+  constexpr
+  auto reserve_nodes([[maybe_unused]] const std::size_t n)
+      -> void
+  {
+    if constexpr ( std::is_same_v<node_allocator, std::pmr::polymorphic_allocator<Node>> ) {
+      if ( std::is_constant_evaluated() ) { return; }
+      if ( auto *pool = dynamic_cast<Node_pool *>(m_alloc.resource()) ) { pool->reserve(n, sizeof(Node), alignof(Node)); }
+    }
+  }
+
+  /// @brief a chain holding [first, last), `count` elements when known up front, else 0
+  template <typename I, typename S>
+  constexpr
+  auto make_chain(I first, const S last, const std::size_t count)
+      -> Chain
+  {
+    if ( count != 0 ) { reserve_nodes(count); }
+    Chain chain;
+    try {
+      for (; first != last; ++first) { chain.append(create_node(*first)); }
+    } catch (...) {
+      drop_chain(chain);
+      throw;
+    }
+    return chain;
+  }
+
+  template <typename R>
+  constexpr
+  auto make_chain(R&& range)
+      -> Chain
+  {
+    if constexpr ( std::ranges::sized_range<R> ) {
+      return make_chain(std::ranges::begin(range), std::ranges::end(range), static_cast<std::size_t>(std::ranges::size(range)));
+    } else {
+      return make_chain(std::ranges::begin(range), std::ranges::end(range), 0);
+    }
+  }
+
+  template <typename I, typename S>
+  constexpr
+  auto make_chain(I first, const S last)
+      -> Chain
+  {
+    if constexpr ( std::sized_sentinel_for<S, I> ) {
+      return make_chain(std::move(first), last, static_cast<std::size_t>(last - first));
+    } else {
+      return make_chain(std::move(first), last, 0);
+    }
+  }
+
+  /// @brief links `chain` before `pos` in one step, a null `pos` means after the tail
+  constexpr
+  auto link(Node *pos, const Chain& chain)
+      noexcept -> void
+  {
+    if ( chain.m_first != nullptr ) { link_chain(pos, chain.m_first, chain.m_last, chain.m_size); }
+  }
+
+  /// @brief takes the nodes of `rhs`, leaving it empty
+  constexpr
+  auto steal(List_& rhs)
+      noexcept -> void
+  {
+    m_head    = rhs.m_head;
+    m_tail    = rhs.m_tail;
+    m_size    = rhs.m_size;
+    m_cursor  = nullptr;
+    //
+    rhs.m_head    = nullptr;
+    rhs.m_tail    = nullptr;
+    rhs.m_size    = {};
+    rhs.m_cursor  = nullptr;
+  }
+
+  using detail::Failed_slot_for<T, Policy>::failed;
+
+  /// @brief true when the operation must bail out, see `detail::fails`
+  [[nodiscard]] static constexpr auto fails(const bool bad, const Apology apology)
+      -> bool
+  {
+    return detail::fails<Policy>(bad, apology);
+  }
+
+  /**
+  * @brief bidirectional iterator, `end()` holds no node but knows its list so `--end()` is the tail
+  * @tparam Const true for `const_iterator`
+  */
+  template <bool Const>
+  class basic_iterator {
+  private:
+    friend class List_;
+    template <bool> friend class basic_iterator;
+    //
+    Node        *node_ptr {nullptr};
+    const List_ *list_ptr {nullptr};
+    //
+    constexpr basic_iterator(Node *newPtr, const List_ *list) noexcept
+      : node_ptr(newPtr), list_ptr(list) {}
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, const T *, T *>;
+    using reference         = std::conditional_t<Const, const T &, T &>;
+    //
+    constexpr basic_iterator() noexcept = default;
+    // iterator -> const_iterator
+    constexpr basic_iterator(const basic_iterator<!Const>& other) noexcept requires Const
+      : node_ptr(other.node_ptr), list_ptr(other.list_ptr) {}
+    //
+    template <bool C>
+    constexpr bool operator==(const basic_iterator<C>& rhs) const noexcept {
+      return node_ptr == rhs.node_ptr;
+    }
+    //
+    constexpr reference operator*() const noexcept {
+      return node_ptr->m_data;
+    }
+    //
+    constexpr pointer operator->() const noexcept {
+      return std::addressof(node_ptr->m_data);
+    }
+    // pre increment
+    constexpr basic_iterator& operator++() noexcept {
+      node_ptr = node_ptr->m_next;
+      return *this;
+    }
+    // pre decrement
+    constexpr basic_iterator& operator--() noexcept {
+      node_ptr = ( node_ptr != nullptr ) ? node_ptr->m_prev : list_ptr->m_tail;
+      return *this;
+    }
+    // post increment
+    constexpr basic_iterator operator++(int) noexcept {
+      basic_iterator old = *this;
+      ++*this;
+      return old;
+    }
+    // post decrement
+    constexpr basic_iterator operator--(int) noexcept {
+      basic_iterator old = *this;
+      --*this;
+      return old;
+    }
+  }; // end of class basic_iterator
+
+public:
+
+  using value_type              = T;
+  using allocator_type          = Alloc;
+  using size_type               = std::size_t;
+  using difference_type         = std::ptrdiff_t;
+  using reference               = T &;
+  using const_reference         = const T &;
+  using iterator                = basic_iterator<false>;
+  using const_iterator          = basic_iterator<true>;
+  using reverse_iterator        = std::reverse_iterator<iterator>;
+  using const_reverse_iterator  = std::reverse_iterator<const_iterator>;
+
+  [[nodiscard]] constexpr auto begin()  const noexcept -> const_iterator { return const_iterator(m_head, this); }
+  [[nodiscard]] constexpr auto end()    const noexcept -> const_iterator { return const_iterator(nullptr, this); }
+  [[nodiscard]] constexpr auto begin()  noexcept -> iterator { return iterator(m_head, this); }
+  [[nodiscard]] constexpr auto end()    noexcept -> iterator { return iterator(nullptr, this); }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] constexpr auto cend()   const noexcept -> const_iterator { return end(); }
+  //
+  [[nodiscard]] constexpr auto rbegin()   const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+  [[nodiscard]] constexpr auto rend()     const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+  [[nodiscard]] constexpr auto rbegin()   noexcept -> reverse_iterator { return reverse_iterator(end()); }
+  [[nodiscard]] constexpr auto rend()     noexcept -> reverse_iterator { return reverse_iterator(begin()); }
+  [[nodiscard]] constexpr auto crbegin()  const noexcept -> const_reverse_iterator { return rbegin(); }
+  [[nodiscard]] constexpr auto crend()    const noexcept -> const_reverse_iterator { return rend(); }
+
+  /* constructors */
+  constexpr List_() noexcept {
+    m_head    = nullptr;
+    m_tail    = nullptr;
+    m_size    = 0;
+  }
+  //
+  explicit constexpr List_(const Alloc& alloc) noexcept
+    : m_alloc(alloc) {}
+  //
+  constexpr List_(List_ && rhs) noexcept
+    : m_head(nullptr), m_tail(nullptr), m_size(0), m_alloc(std::move(rhs.m_alloc)) {
+    steal(rhs);
+  }
+  //
+  constexpr List_(const List_& rhs)
+    : m_alloc(node_traits::select_on_container_copy_construction(rhs.m_alloc)) {
+    link(nullptr, make_chain(rhs.begin(), rhs.end(), rhs.m_size));
+  }
+
+  /// @brief the elements of [first, last), built as one chain
+  template <std::input_iterator I, std::sentinel_for<I> S>
+    requires std::constructible_from<T, std::iter_reference_t<I>> && (!std::convertible_to<I, T>)
+  constexpr List_(I first, S last, const Alloc& alloc = Alloc())
+    : m_alloc(alloc) {
+    link(nullptr, make_chain(std::move(first), last));
+  }
+
+  /// @brief the elements of `range`, built as one chain, `List_ l(from_range, v)`
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+  constexpr List_(from_range_t, R&& range, const Alloc& alloc = Alloc())
+    : m_alloc(alloc) {
+    link(nullptr, make_chain(std::forward<R>(range)));
+  }
+
+  //
+  template<typename ...args>
+    requires (std::convertible_to<const args&, T> && ...)
+  explicit constexpr List_(const args& ...arg) {
+    (push_back(arg),...);
+  }
+
+  //
+  template<typename ...args>
+    requires (std::convertible_to<args&&, T> && ...)
+  explicit constexpr List_(args&& ...arg) {
+    (push_back(std::forward<args>(arg)),...);
+  }
+
+  //
+  explicit constexpr List_(std::initializer_list<T> &&arg) {
+    link(nullptr, make_chain(arg));
+  }
+
+  //
+  explicit constexpr List_(const std::initializer_list<T> &arg) {
+    link(nullptr, make_chain(arg));
+  }
+
+  //
+  constexpr List_(const std::initializer_list<T> &arg, const Alloc& alloc)
+    : m_alloc(alloc) {
+    link(nullptr, make_chain(arg));
+  }
+
+  //
+  constexpr ~List_() { release(); }
+
+  //
+  constexpr List_& operator=(const List_& rhs) {
+    if (this != &rhs) {
+      release();
+      if constexpr ( node_traits::propagate_on_container_copy_assignment::value ) {
+        m_alloc = rhs.m_alloc;
+      }
+      link(nullptr, make_chain(rhs.begin(), rhs.end(), rhs.m_size));
+    }
+    return *this;
+  }
+
+  //
+  constexpr List_& operator=(List_&& rhs)
+      noexcept(node_traits::propagate_on_container_move_assignment::value
+            || node_traits::is_always_equal::value) {
+    if (this != &rhs) {
+      release();
+      if constexpr ( node_traits::propagate_on_container_move_assignment::value ) {
+        m_alloc = std::move(rhs.m_alloc);
+        steal(rhs);
+      } else {
+        if ( m_alloc == rhs.m_alloc ) { steal(rhs); return *this; }
+        // nodes can't change hands between unequal allocators
+        for (Node *it = rhs.m_head; it != nullptr; it = it->m_next) {
+          push_back(std::move(it->m_data));
+        }
+        rhs.release();
+      }
+    }
+    return *this;
+  }
+
+  /*@ methods: */
+  /**
+  * @brief a deep copy sharing no node with this list, the same as the copy constructor,
+  *   spelled out where a copy is meant to be one ( `Persistent_list_` has O(1) snapshots )
+  * @complexity O(n)
+  */
+  [[nodiscard]]
+  constexpr
+  auto clone() const
+      -> List_
+  {
+    return List_(*this);
+  }
+
+  /**
+  * @brief returns a copy of the allocator used for the nodes
+  * @complexity O(1)
+  */
+  [[nodiscard]] constexpr auto get_allocator()
+      const noexcept -> Alloc
+  {
+    return Alloc(m_alloc);
+  }
+
+  /**
+  * @brief check if list is empty
+  * @complexity O(1)
+  * @return true
+  * @return false
+  */
+  [[nodiscard]] constexpr auto is_empty()
+      const noexcept -> bool
+  {
+    return m_head == nullptr;
+  }
+
+  /**
+  * @brief returns size of the list
+  * @complexity O(1)
+  * @return std::size_t
+  */
+  [[nodiscard]]
+  constexpr
+  auto size() const noexcept
+      -> std::size_t { return m_size; }
+
+  /**
+  * @brief what this list did so far, only with `stats::Count`, see "stats.hpp",
+  *   `stats::process()` sums every counted list
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto counters() const noexcept
+      -> stats::Counters
+    requires Stats::enabled
+  {
+    stats::Counters snapshot  = m_stats.counters();
+    snapshot.m_bytes_in_use   = m_size * sizeof(Node);
+    return snapshot;
+  }
+
+  /**
+  * @brief returns first element
+  * @complexity O(1)
+  * @return T&
+  */
+  [[nodiscard]]
+  constexpr
+  auto front()
+      -> T &
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return failed(); }
+    return m_head->m_data;
+  }
+
+  /**
+  * @brief return last element&
+  * @complexity O(1)
+  * @return T&
+  */
+  [[nodiscard]]
+  constexpr
+  auto back()
+      -> T &
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return failed();}
+    return m_tail->m_data;
+  }
+
+  /**
+  * @brief return last element&
+  * @complexity O(1)
+  * @return T&
+  */
+  [[nodiscard]]
+  constexpr
+  auto back() const
+      -> T
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return failed();}
+    return m_tail->m_data;
+  }
+
+  /**
+   * @brief prints the list in both `forward and backword`
+   *
+   * @param out
+   * @param order `true` for forward `false` for backword
+   * @param delimiter
+   */
+  auto print(std::ostream& out, const bool order = true, const char delimiter = ' ')
+      const -> void
+  {
+    if ( fails(is_empty(), Apology::empty) )   { return; }
+    if ( order ) {
+      for ( auto&& i : *this ) { out << i << ' '; }
+      out << delimiter;
+      return;
+    }
+    for ( auto i = rbegin(); i != rend(); ++i ) {
+      out << *i << ' ';
+    }
+    out << delimiter;
+  }
+
+#ifdef LIST_IOSTREAM
+  /// @brief prints to `std::cout`, only when `LIST_IOSTREAM` is defined so `<iostream>` stays opt in
+  auto print(const bool order = true, const char delimiter = ' ')
+      const -> void
+  {
+    print(std::cout, order, delimiter);
+  }
+#endif
+
+  /**
+  * @brief writes the list in the binary format of `serial.hpp`, trivially copyable elements
+  *   go out as one block of raw bytes, strings as length + characters
+  * @complexity O(n)
+  * @return false when a write failed
+  */
+  auto save(std::ostream& out) const -> bool requires serial::serializable<T> { return save_to(serial::Ostream_sink{out}); }
+  auto save(std::FILE *out)    const -> bool requires serial::serializable<T> { return save_to(serial::File_sink{out}); }
+
+  /**
+  * @brief replaces the elements with a list written by `save`, reading trivially copyable
+  *   elements in large blocks and, for a `pmr::List_` over a `Node_pool`, taking each batch of
+  *   nodes from one block; on a bad header, an absurd size or short data returns false and
+  *   leaves the list as it was
+  * @complexity O(n)
+  */
+  auto load(std::istream& in) -> bool requires serial::serializable<T> { return load_from(serial::Istream_source{in}); }
+  auto load(std::FILE *in)    -> bool requires serial::serializable<T> { return load_from(serial::File_source{in}); }
+
+  /**
+  * @brief return element at given position&, remembers the position so nearby
+  *   indices are reached from here next time, not from the head
+  * @complexity O(min(pos, size - pos, |pos - last pos|))
+  * @param times
+  * @return auto&
+  */
+  [[nodiscard]]
+ constexpr
+  auto at(const std::size_t& pos)
+      -> auto &
+  {
+    m_stats.called(stats::Op::at);
+    if ( fails(is_empty(), Apology::empty) ) { return failed();}
+    if ( fails(pos > m_size-1, Apology::invalid_position) ) { return failed(); }
+    return seek(pos)->m_data;
+  }
+
+  /// @brief uses the position remembered by the non const lookups but never moves it, safe to call from several threads
+  [[nodiscard]]
+  constexpr
+  auto at(const std::size_t& pos) const
+      -> auto
+  {
+    m_stats.called(stats::Op::at);
+    if ( fails(is_empty(), Apology::empty) ) { return failed();}
+    if ( fails(pos > m_size-1, Apology::invalid_position) ) { return failed(); }
+    return node_at(pos)->m_data;
+  }
+
+  /**
+  * @brief first element or null when empty, never apologizes
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto try_front()
+      noexcept -> T *
+  {
+    return is_empty() ? nullptr : std::addressof(m_head->m_data);
+  }
+
+  [[nodiscard]]
+  constexpr
+  auto try_front() const
+      noexcept -> const T *
+  {
+    return is_empty() ? nullptr : std::addressof(m_head->m_data);
+  }
+
+  /**
+  * @brief last element or null when empty, never apologizes
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto try_back()
+      noexcept -> T *
+  {
+    return is_empty() ? nullptr : std::addressof(m_tail->m_data);
+  }
+
+  [[nodiscard]]
+  constexpr
+  auto try_back() const
+      noexcept -> const T *
+  {
+    return is_empty() ? nullptr : std::addressof(m_tail->m_data);
+  }
+
+  /**
+  * @brief element at `pos` or null when out of range, never apologizes
+  * @complexity same as `at()`
+  */
+  [[nodiscard]]
+  constexpr
+  auto try_at(const std::size_t pos)
+      noexcept -> T *
+  {
+    return pos < m_size ? std::addressof(seek(pos)->m_data) : nullptr;
+  }
+
+  [[nodiscard]]
+  constexpr
+  auto try_at(const std::size_t pos) const
+      noexcept -> const T *
+  {
+    return pos < m_size ? std::addressof(node_at(pos)->m_data) : nullptr;
+  }
+
+  /**
+  * @brief add element at end of list
+  * @complexity O(1)
+  * @param arg
+  */
+  constexpr
+  auto push_back(T &&arg)
+      -> void
+  {
+    m_stats.called(stats::Op::push_back);
+    link_back( create_node(std::move(arg)) );
+  }
+
+  /**
+  * @brief add element at end of list
+  * @complexity O(1)
+  * @param arg
+  */
+  constexpr
+  auto push_back(const T &arg)
+      -> void
+  {
+    m_stats.called(stats::Op::push_back);
+    link_back( create_node(arg) );
+  }
+
+  //
+  template<typename ...args>
+  constexpr auto push_back(const args&...arg)
+      -> void
+  {
+    (push_back(arg),...);
+  }
+
+  /**
+  * @brief constructs an element in place at the end of list
+  * @complexity O(1)
+  * @param args forwarded to the constructor of `T`
+  * @return T& the new element
+  */
+  template <typename ...Args>
+  constexpr
+  auto emplace_back(Args&& ...args)
+      -> T &
+  {
+    m_stats.called(stats::Op::push_back);
+    Node *node = create_node(std::forward<Args>(args)...);
+    link_back(node);
+    return node->m_data;
+  }
+
+  /**
+  * @brief constructs an element in place at the beginning of list
+  * @complexity O(1)
+  * @param args forwarded to the constructor of `T`
+  * @return T& the new element
+  */
+  template <typename ...Args>
+  constexpr
+  auto emplace_front(Args&& ...args)
+      -> T &
+  {
+    m_stats.called(stats::Op::push_front);
+    Node *node = create_node(std::forward<Args>(args)...);
+    link_front(node);
+    return node->m_data;
+  }
+
+  /**
+  * @brief add element at the beginning of list
+  * @complexity O(1)
+  * @param arg
+  */
+   constexpr
+  auto push_front(const T &arg)
+      -> void
+  {
+    m_stats.called(stats::Op::push_front);
+    link_front( create_node(arg) );
+  }
+
+  /**
+  * @brief add element at the beginning of list
+  * @complexity O(1)
+  * @param arg
+  */
+  constexpr
+  auto push_front(T &&arg)
+      -> void
+  {
+    m_stats.called(stats::Op::push_front);
+    link_front( create_node(std::move(arg)) );
+  }
+
+  //
+  constexpr
+  auto push_front(const auto& ...arg)
+      -> void
+  {
+    (push_front(arg), ...);
+  }
+
+  /**
+  * @brief add element at given position
+  * @complexity O(min(pos, size - pos, |pos - last pos|))
+  * @param pos
+  * @param arg
+  */
+  constexpr
+  auto push_at(const std::size_t pos, const T &arg)
+      -> void
+  {
+    m_stats.called(stats::Op::push_at);
+    if ( fails(pos >= m_size, Apology::invalid_position) ) { return; }
+    if (pos == 0)                 { push_front(arg); return; }
+    if (pos == m_size-1)          {push_back(arg); return; }
+    /* adding nodes between previous and next */
+    link_before(seek(pos), create_node(arg));
+  }
+
+  constexpr
+  auto push_at(const std::size_t pos, T &&arg)
+      -> void
+  {
+    m_stats.called(stats::Op::push_at);
+    if ( fails(pos >= m_size, Apology::invalid_position) ) { return; }
+    if (pos == 0)                 { push_front(std::move(arg)); return; }
+    if (pos == m_size-1)          {push_back(std::move(arg)); return; }
+    /* adding nodes between previous and next */
+    link_before(seek(pos), create_node(std::move(arg)));
+  }
+
+  /**
+  * @brief add element at after given position
+  * @complexity O(min(pos, size - pos, |pos - last pos|))
+  * @param pos
+  * @param arg
+  */
+  constexpr
+  auto push_after_at(const std::size_t pos, const T &arg)
+      -> void
+  {
+    m_stats.called(stats::Op::push_at);
+    if ( fails(pos >= m_size, Apology::invalid_position) ) { return; }
+    if (pos == m_size-1)          {push_back(arg); return; }
+    /* adding nodes between previous and next */
+    Node *prev_node = seek(pos); // hold previous node
+    link_between(prev_node, create_node(arg), prev_node->m_next);
+  }
+
+  /**
+  * @brief add element at after given position
+  * @complexity O(min(pos, size - pos, |pos - last pos|))
+  * @param pos
+  * @param arg
+  */
+  constexpr
+  auto push_after_at(const std::size_t pos, T &&arg)
+      -> void
+  {
+    m_stats.called(stats::Op::push_at);
+    if ( fails(pos >= m_size, Apology::invalid_position) ) { return; }
+    if (pos == m_size-1)          {push_back(std::move(arg)); return; }
+    /* adding nodes between previous and next */
+    Node *prev_node = seek(pos); // hold previous node
+    link_between(prev_node, create_node(std::move(arg)), prev_node->m_next);
+  }
+
+  /**
+  * @brief adds value after specific location
+  * @param after : the value you want add value after it
+  * @param val : the value
+  */
+  constexpr
+  auto push_after_value(T&& after, T&& val)
+      -> void
+  {
+    if ( fails(is_empty(), Apology::empty) ) { return; }
+    if (after == m_tail->m_data) { push_back(std::move(val)); return; }
+    Node *it = find_node(after);
+    if ( fails(it == nullptr, Apology::not_found) ) { return; }
+    link_between(it, create_node(std::move(val)), it->m_next);
+  }
+
+  constexpr
+  auto push_after_value(const T& after, const T& val)
+      -> void
+  {
+    if ( fails(is_empty(), Apology::empty) ) { return; }
+    if (after == m_tail->m_data) { push_back(val); return; }
+    Node *it = find_node(after);
+    if ( fails(it == nullptr, Apology::not_found) ) { return; }
+    link_between(it, create_node(val), it->m_next);
+  }
+
+  /**
+  * @brief adds value before specific location
+  * @param before : the value you want add value before it
+  * @param val : the value
+  */
+  constexpr
+  auto push_before_value(T&& before, T&& val)
+      -> void
+  {
+    if ( fails(is_empty(), Apology::empty) ) { return; }
+    if (before == m_head->m_data) { push_front(std::move(val)); return; }
+    Node *it = find_node(before);
+    if ( fails(it == nullptr, Apology::not_found) ) { return; }
+    link_between(it->m_prev, create_node(std::move(val)), it);
+  }
+
+  constexpr
+  auto push_before_value(const T& before, const T& val)
+      -> void
+  {
+    if ( fails(is_empty(), Apology::empty) ) { return; }
+    if (before == m_head->m_data) { push_front(val); return; }
+    Node *it = find_node(before);
+    if ( fails(it == nullptr, Apology::not_found) ) { return; }
+    link_between(it->m_prev, create_node(val), it);
+  }
+
+  /**
+  * @brief inserts `arg` before `pos`, `end()` appends
+  * @complexity O(1)
+  * @param pos
+  * @param arg
+  * @return iterator to the inserted element
+  */
+  constexpr
+  auto insert(const_iterator pos, const T &arg)
+      -> iterator
+  {
+    m_stats.called(stats::Op::insert);
+    if ( fails(pos.list_ptr != this, Apology::invalid_position) ) { return end(); }
+    Node *node = create_node(arg);
+    link_before(pos.node_ptr, node);
+    return iterator(node, this);
+  }
+
+  constexpr
+  auto insert(const_iterator pos, T &&arg)
+      -> iterator
+  {
+    m_stats.called(stats::Op::insert);
+    if ( fails(pos.list_ptr != this, Apology::invalid_position) ) { return end(); }
+    Node *node = create_node(std::move(arg));
+    link_before(pos.node_ptr, node);
+    return iterator(node, this);
+  }
+
+  /**
+  * @brief constructs an element in place before `pos`, `end()` appends
+  * @complexity O(1)
+  * @param pos
+  * @param args forwarded to the constructor of `T`
+  * @return iterator to the new element
+  */
+  template <typename ...Args>
+  constexpr
+  auto emplace(const_iterator pos, Args&& ...args)
+      -> iterator
+  {
+    m_stats.called(stats::Op::insert);
+    if ( fails(pos.list_ptr != this, Apology::invalid_position) ) { return end(); }
+    Node *node = create_node(std::forward<Args>(args)...);
+    link_before(pos.node_ptr, node);
+    return iterator(node, this);
+  }
+
+  /**
+  * @brief inserts the elements of `range` before `pos`, `end()` appends; they are built as one
+  *   chain and linked in a single step, nothing is inserted if one of them throws
+  * @complexity O(range size)
+  * @return iterator to the first inserted element, `pos` when `range` is empty
+  */
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+  constexpr
+  auto insert_range(const_iterator pos, R&& range)
+      -> iterator
+  {
+    m_stats.called(stats::Op::insert);
+    if ( fails(pos.list_ptr != this, Apology::invalid_position) ) { return end(); }
+    const Chain chain = make_chain(std::forward<R>(range));
+    link(pos.node_ptr, chain);
+    return iterator(chain.m_first != nullptr ? chain.m_first : pos.node_ptr, this);
+  }
+
+  /**
+  * @brief adds the elements of `range` at the end, in order, see `insert_range`
+  * @complexity O(range size)
+  */
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+  constexpr
+  auto append_range(R&& range)
+      -> void
+  {
+    m_stats.called(stats::Op::push_back);
+    link(nullptr, make_chain(std::forward<R>(range)));
+  }
+
+  /**
+  * @brief adds the elements of `range` at the beginning, keeping their order, see `insert_range`
+  * @complexity O(range size)
+  */
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+  constexpr
+  auto prepend_range(R&& range)
+      -> void
+  {
+    m_stats.called(stats::Op::push_front);
+    link(m_head, make_chain(std::forward<R>(range)));
+  }
+
+  /**
+  * @brief replaces the elements with those of [first, last), built before the old ones go
+  *   so a throwing element leaves the list as it was
+  * @complexity O(size + (last - first))
+  */
+  template <std::input_iterator I, std::sentinel_for<I> S>
+    requires std::constructible_from<T, std::iter_reference_t<I>>
+  constexpr
+  auto assign(I first, S last)
+      -> void
+  {
+    const Chain chain = make_chain(std::move(first), last);
+    release();
+    link(nullptr, chain);
+  }
+
+  constexpr
+  auto assign(std::initializer_list<T> values)
+      -> void
+  {
+    assign(values.begin(), values.end());
+  }
+
+  /**
+  * @brief replaces the elements with those of `range`, see `assign`
+  * @complexity O(size + range size)
+  */
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+  constexpr
+  auto assign_range(R&& range)
+      -> void
+  {
+    const Chain chain = make_chain(std::forward<R>(range));
+    release();
+    link(nullptr, chain);
+  }
+
+  /**
+  * @brief removes the element at `pos`
+  * @complexity O(1)
+  * @param pos
+  * @return iterator to the element after the removed one
+  */
+  constexpr
+  auto erase(const_iterator pos)
+      -> iterator
+  {
+    m_stats.called(stats::Op::erase);
+    if ( fails(pos.list_ptr != this || pos.node_ptr == nullptr, Apology::invalid_position) ) { return end(); }
+    Node *next = pos.node_ptr->m_next;
+    unlink(pos.node_ptr);
+    return iterator(next, this);
+  }
+
+  /**
+  * @brief removes the elements in [first, last)
+  * @complexity O(last - first)
+  * @param first
+  * @param last
+  * @return iterator to `last`
+  */
+  constexpr
+  auto erase(const_iterator first, const_iterator last)
+      -> iterator
+  {
+    m_stats.called(stats::Op::erase);
+    if ( fails(first.list_ptr != this || last.list_ptr != this, Apology::invalid_position) ) { return end(); }
+    Node *it = first.node_ptr;
+    while ( it != last.node_ptr ) {
+      Node *next = it->m_next;
+      unlink(it);
+      it = next;
+    }
+    return iterator(last.node_ptr, this);
+  }
+
+  /**
+  * @brief moves every element of `other` before `pos` by relinking its nodes, `other` ends empty,
+  *   iterators to the moved elements still reach them but report `other` as their list
+  * @complexity O(1), O(other.size()) when the allocators compare unequal
+  * @param pos
+  * @param other
+  */
+  constexpr
+  auto splice(const_iterator pos, List_& other)
+      -> void
+  {
+    m_stats.called(stats::Op::splice);
+    if ( fails(pos.list_ptr != this || &other == this, Apology::invalid_position) ) { return; }
+    if (other.is_empty())                       { return; }
+    if (!shares_allocator(other)) { transfer(pos.node_ptr, other, other.m_head, nullptr); return; }
+    Node             *first = other.m_head;
+    Node             *last  = other.m_tail;
+    const std::size_t n     = other.m_size;
+    other.unlink_chain(first, last, n);
+    link_chain(pos.node_ptr, first, last, n);
+  }
+
+  constexpr
+  auto splice(const_iterator pos, List_&& other)
+      -> void
+  {
+    splice(pos, other);
+  }
+
+  /**
+  * @brief moves [first, last) of `other` before `pos` by relinking, `other` may be this list
+  *   as long as `pos` is outside the range
+  * @complexity O(1) to relink, plus O(last - first) to count the moved elements
+  *   unless the range is all of `other` or `other` is this list
+  * @param pos
+  * @param other
+  * @param first
+  * @param last
+  */
+  constexpr
+  auto splice(const_iterator pos, List_& other, const_iterator first, const_iterator last)
+      -> void
+  {
+    m_stats.called(stats::Op::splice);
+    if ( fails(pos.list_ptr != this || first.list_ptr != &other || last.list_ptr != &other, Apology::invalid_position) ) { return; }
+    if (first == last)                                                 { return; }
+    if (&other == this && (pos == first || pos.node_ptr == last.node_ptr)) { return; }
+    if (&other != this && !shares_allocator(other)) {
+      transfer(pos.node_ptr, other, first.node_ptr, last.node_ptr); return;
+    }
+    Node       *head  = first.node_ptr;
+    Node       *tail  = ( last.node_ptr != nullptr ) ? last.node_ptr->m_prev : other.m_tail;
+    std::size_t n     = 0;
+    if (&other != this) {
+      if ( head == other.m_head && tail == other.m_tail ) { n = other.m_size; }
+      else { for (const Node *it = head; it != last.node_ptr; it = it->m_next) { ++n; } }
+    }
+    other.unlink_chain(head, tail, n);
+    link_chain(pos.node_ptr, head, tail, n);
+  }
+
+  constexpr
+  auto splice(const_iterator pos, List_&& other, const_iterator first, const_iterator last)
+      -> void
+  {
+    splice(pos, other, first, last);
+  }
+
+  /**
+  * @brief cuts the list at `pos`, [pos, end()) is returned as a new list sharing the allocator
+  * @complexity O(1) to relink, plus O(min(k, size - k)) to count the k moved elements
+  * @param pos
+  * @return the tail, empty when `pos` is `end()`
+  */
+  [[nodiscard]]
+  constexpr
+  auto split_at(const_iterator pos)
+      -> List_
+  {
+    List_ rest(get_allocator());
+    if ( fails(pos.list_ptr != this, Apology::invalid_position) )   { return rest; }
+    if (pos.node_ptr == nullptr) { return rest; }
+    Node             *last  = m_tail;
+    const std::size_t n     = count_to_end(pos.node_ptr);
+    unlink_chain(pos.node_ptr, last, n);
+    rest.link_chain(nullptr, pos.node_ptr, last, n);
+    return rest;
+  }
+
+  /**
+  * @brief appends every element of `other` by relinking its nodes
+  * @complexity O(1), O(other.size()) when the allocators compare unequal
+  * @param other
+  */
+  constexpr
+  auto concat(List_&& other)
+      -> void
+  {
+    splice(cend(), other);
+  }
+
+  /// @brief pop certain value/s from list
+  constexpr
+  auto pop_value(T&& val)
+      -> void
+  {
+    (void)remove(val);
+  }
+
+  /**
+  * @brief removes every element equal to `value` in one pass, `value` may live in the list
+  * @complexity O(n)
+  * @param value
+  * @return number of removed elements
+  */
+  constexpr
+  auto remove(const T& value)
+      -> std::size_t
+  {
+    const std::size_t before  = m_size;
+    Node             *self    = nullptr; // the node holding `value` itself goes last
+    for (Node *it = m_head; it != nullptr; ) {
+      Node *next = it->m_next;
+      if ( it->m_data == value ) {
+        if ( std::addressof(it->m_data) == std::addressof(value) ) { self = it; }
+        else                                                       { unlink(it); }
+      }
+      it = next;
+    }
+    if ( self != nullptr ) { unlink(self); }
+    return before - m_size;
+  }
+
+  /**
+  * @brief removes every element satisfying `pred` in one pass
+  * @complexity O(n)
+  * @param pred
+  * @return number of removed elements
+  */
+  template <typename Pred>
+    requires std::predicate<Pred&, const T&>
+  constexpr
+  auto remove_if(Pred pred)
+      -> std::size_t
+  {
+    const std::size_t before = m_size;
+    for (Node *it = m_head; it != nullptr; ) {
+      Node *next = it->m_next;
+      if ( pred(std::as_const(it->m_data)) ) { unlink(it); }
+      it = next;
+    }
+    return before - m_size;
+  }
+
+  /**
+  * @brief removes all but the first element of every run of adjacent equivalent elements
+  * @complexity O(n)
+  * @param same `same(a, b)` is true when `b` duplicates the kept `a`, defaults to `==`
+  * @return number of removed elements
+  */
+  template <typename BinaryPred = std::equal_to<>>
+    requires std::predicate<BinaryPred&, const T&, const T&>
+  constexpr
+  auto unique(BinaryPred same = {})
+      -> std::size_t
+  {
+    const std::size_t before = m_size;
+    Node *kept = m_head;
+    while ( kept != nullptr && kept->m_next != nullptr ) {
+      if ( same(std::as_const(kept->m_data), std::as_const(kept->m_next->m_data)) ) { unlink(kept->m_next); }
+      else                                                                            { kept = kept->m_next; }
+    }
+    return before - m_size;
+  }
+
+  /**
+  * @brief removes every element equal to an earlier one, keeping first occurrences in order,
+  *   remembers seen elements in a hash set of pointers so nothing is copied
+  * @complexity O(n) expected
+  * @return number of removed elements
+  */
+  auto dedupe()
+      -> std::size_t
+    requires requires (const T& v) { { std::hash<T>{}(v) } -> std::convertible_to<std::size_t>; }
+  {
+    struct Hash {
+      auto operator()(const T *p) const -> std::size_t { return std::hash<T>{}(*p); }
+    };
+    struct Equal {
+      auto operator()(const T *a, const T *b) const -> bool { return *a == *b; }
+    };
+    std::unordered_set<const T *, Hash, Equal> seen;
+    const std::size_t before = m_size;
+    for (Node *it = m_head; it != nullptr; ) {
+      Node *next = it->m_next;
+      if ( !seen.insert(std::addressof(it->m_data)).second ) { unlink(it); }
+      it = next;
+    }
+    return before - m_size;
+  }
+
+  /**
+  * @brief remove last element
+  * @complexity O(1)
+  */
+  constexpr
+  auto pop_back()
+      -> void
+  {
+    m_stats.called(stats::Op::pop_back);
+    if ( fails(is_empty(), Apology::empty) )  { return; }
+    unlink(m_tail);
+  }
+
+  /**
+  * @brief remove first element
+  * @complexity O(1)
+  */
+  constexpr
+  auto pop_front()
+      -> void
+  {
+    m_stats.called(stats::Op::pop_front);
+    if ( fails(is_empty(), Apology::empty) )   { return; }
+    unlink(m_head);
+  }
+
+  /**
+  * @brief removes and returns the first element, nothing when empty, never apologizes
+  * @complexity O(1)
+  */
+  constexpr
+  auto try_pop_front()
+      -> std::optional<T>
+  {
+    if ( is_empty() ) { return std::nullopt; }
+    std::optional<T> value( std::move(m_head->m_data) );
+    unlink(m_head);
+    return value;
+  }
+
+  /**
+  * @brief removes and returns the last element, nothing when empty, never apologizes
+  * @complexity O(1)
+  */
+  constexpr
+  auto try_pop_back()
+      -> std::optional<T>
+  {
+    if ( is_empty() ) { return std::nullopt; }
+    std::optional<T> value( std::move(m_tail->m_data) );
+    unlink(m_tail);
+    return value;
+  }
+
+  /**
+  * @brief remove element at given position
+  * @complexity O(min(pos, size - pos, |pos - last pos|))
+  */
+  constexpr
+  auto pop_at(const std::size_t& pos)
+      -> void
+  {
+    m_stats.called(stats::Op::pop_at);
+    if ( fails(is_empty(), Apology::empty) )               { return; }
+    if ( fails(pos >= m_size, Apology::invalid_position) )            { return; }
+    unlink( seek(pos) );
+  }
+
+  /// @brief sorts the list and pops duplicates, see `dedupe()` to keep the order
+  constexpr
+  auto pop_duplicates()
+      -> void
+  {
+    if ( fails(is_empty(), Apology::empty) ) { return; }
+    sort();
+    (void)unique();
+  }
+
+  /**
+  * @brief moves the first half of the list to the back of `l1` and the rest to the back of `l2`,
+  *   nodes are relinked, this list ends empty
+  * @complexity O(n / 2) to find the middle, relinking is O(1)
+  * @param l1
+  * @param l2
+  */
+  constexpr
+  auto split(List_ &l1, List_ &l2)
+      -> void
+  {
+    if (is_empty())  { return; }
+    Node             *mid   = node_at(m_size / 2);
+    Node             *last  = m_tail;
+    const std::size_t n     = m_size - m_size / 2;
+    List_ rest(get_allocator());
+    unlink_chain(mid, last, n);
+    rest.link_chain(nullptr, mid, last, n);
+    l1.splice(l1.cend(), *this);
+    l2.splice(l2.cend(), rest);
+  }
+
+  /**
+  * @brief appends `l1` then `l2` to the list by relinking their nodes, both end empty
+  * @complexity O(1)
+  * @param l1
+  * @param l2
+  */
+  constexpr
+  auto merge(List_& l1, List_& l2)
+      -> void
+  {
+    splice(cend(), l1);
+    splice(cend(), l2);
+  }
+
+  /**
+  * @brief: sorts element in ASC order by default, put `true` for DESC
+  * @complexity  O(n log(n))
+  */
+  constexpr
+  auto sort(const bool desc = false)
+      -> void
+  {
+    if ( desc ) { sort( std::greater<>{} ); return; }
+    sort( std::less<>{} );
+  }
+
+  /**
+  * @brief: stable merge sort ordering elements by `comp`, nodes are relinked, elements never move
+  * @complexity  O(n log(n))
+  * @param comp `comp(a, b)` is true when `a` goes before `b`, when it throws the list keeps its old order
+  */
+  template <typename Compare>
+    requires std::predicate<Compare&, const T&, const T&>
+  constexpr
+  auto sort(Compare comp)
+      -> void
+  {
+    m_stats.called(stats::Op::sort);
+    if ( fails(is_empty(), Apology::empty) ) { return; }
+    // runs[i] holds a sorted run of 2^i nodes, higher runs hold earlier nodes
+    // only `m_next` changes until `relink`, so `m_prev` still holds the old order if `comp` throws
+    Node *runs[64] = {};
+    Node *it       = m_head;
+    Node *sorted   = nullptr;
+    try {
+      while ( it != nullptr ) {
+        Node *carry   = it;
+        it            = it->m_next;
+        carry->m_next = nullptr;
+        std::size_t i = 0;
+        for (; runs[i] != nullptr; ++i) {
+          carry   = merge_runs(runs[i], carry, comp);
+          runs[i] = nullptr;
+        }
+        runs[i] = carry;
+      }
+      for (Node *run : runs) {
+        if ( run != nullptr ) { sorted = merge_runs(run, sorted, comp); }
+      }
+    } catch (...) {
+      unmerge(m_tail);
+      throw;
+    }
+    relink(sorted);
+  }
+
+  /**
+  * @brief: merges the sorted `other` into this sorted list by relinking nodes, `other` ends empty,
+  *   stable: on ties elements of this list go first
+  * @complexity  O(n + m)
+  * @param other sorted by `comp`
+  * @param comp `comp(a, b)` is true when `a` goes before `b`, defaults to ASC,
+  *   when it throws both lists keep their elements in their old order
+  */
+  template <typename Compare = std::less<>>
+    requires std::predicate<Compare&, const T&, const T&>
+  constexpr
+  auto merge_sorted(List_&& other, Compare comp = {})
+      -> void
+  {
+    if (&other == this || other.is_empty()) { return; }
+    if (!shares_allocator(other)) { // nodes must be freed by our allocator, move them over first
+      List_ moved(get_allocator());
+      moved.transfer(nullptr, other, other.m_head, nullptr);
+      try {
+        merge_sorted(std::move(moved), comp);
+      } catch (...) {
+        other.transfer(nullptr, moved, moved.m_head, nullptr);
+        throw;
+      }
+      return;
+    }
+    Node             *second  = other.m_head;
+    Node             *last    = other.m_tail;
+    const std::size_t n       = other.m_size;
+    other.unlink_chain(second, last, n);
+    Node             *merged  = nullptr;
+    try {
+      merged = merge_runs(m_head, second, comp);
+    } catch (...) { // both chains still have their `m_prev`, hand `other` its nodes back
+      unmerge(m_tail);
+      unmerge(last);
+      other.m_head = second;
+      other.m_tail = last;
+      other.m_size = n;
+      throw;
+    }
+    m_size += n;
+    relink(merged);
+  }
+
+  /**
+  * @brief check if the list is sorted ASC
+  * @complexity O(n)
+  */
+  [[nodiscard]]
+  constexpr
+  auto is_sorted() const
+      -> bool
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return false; }
+    bool check  = false;
+    Node *it    = {m_head};
+    while ( it != nullptr && it->m_next != nullptr ) {
+      if ( it->m_next->m_data >= it->m_data ) { check = true; }
+      else {
+        check = false;
+        break;
+      }
+      it = it->m_next;
+    }
+    return check;
+  }
+
+  /**
+  * @brief search for a value
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]]
+  constexpr
+  auto search(const T &target) const
+      -> bool
+  {
+    m_stats.called(stats::Op::search);
+    if ( fails(is_empty(), Apology::empty) )  { return false; }
+    return find_node(target) != nullptr;
+  }
+
+  /**
+  * @brief search for a value
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]]
+  constexpr
+  auto search(T &&target) const
+      -> bool
+  {
+    return search(std::as_const(target));
+  }
+
+  /**
+  * @brief returns the location of that node containing target, count from the right to left
+  * @complexity O(n)
+  * @param target
+  * @return std::int64_t
+  */
+  [[nodiscard]]
+  constexpr
+  auto locate(const T& target) const
+      -> std::int64_t
+  {
+    m_stats.called(stats::Op::locate);
+    if ( fails(is_empty(), Apology::empty) )  { return -1; }
+    for (std::int64_t j = 0; const auto& i : *this ) {
+      if ( i == target ) { m_stats.walked(static_cast<std::size_t>(j) + 1); return j; }
+      ++j;
+    }
+    m_stats.walked(m_size);
+    return -1;
+  }
+
+  /**
+  * @brief returns the location of that node containing target, count from the right to left
+  * @complexity O(n)
+  * @param target
+  * @return std::int64_t
+  */
+  [[nodiscard]]
+  constexpr
+  auto locate(T &&target) const
+      -> std::int64_t
+  {
+    return locate(std::as_const(target));
+  }
+
+  /**
+  * @brief number of elements equal to target, 0 on an empty list
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]]
+  constexpr
+  auto count(const T& target) const
+      -> std::size_t
+  {
+    return static_cast<std::size_t>(std::count(begin(), end(), target));
+  }
+
+  /**
+  * @brief copies the first `N` elements into an array, how a list built during constant
+  *   evaluation outlives it, see `freeze`
+  * @complexity O(N)
+  */
+  template <std::size_t N>
+    requires std::default_initializable<T> && std::copyable<T>
+  [[nodiscard]]
+  constexpr
+  auto to_array() const
+      -> std::array<T, N>
+  {
+    std::array<T, N> out = {};
+    if ( fails(N > m_size, Apology::invalid_position) ) { return out; }
+    std::copy_n(begin(), N, out.begin());
+    return out;
+  }
+
+  /**
+  * @brief erases the list
+  * @complexity O(n)
+  */
+  constexpr
+  auto clear()
+      -> void
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return; }
+    release();
+  }
+}; // end of class List_
+
+/**
+* @brief runs `Make`, a captureless lambda returning a `List_`, at compile time and keeps the
+*   elements in an array of exactly its size, the nodes never reach the running program
+*
+*   constexpr auto squares = freeze<[] { List_<int> l; for (int i = 0; i < 8; ++i) { l.push_back(i * i); } return l; }>();
+*/
+template <auto Make, typename List = decltype(Make())>
+consteval
+auto freeze()
+    -> std::array<typename List::value_type, Make().size()>
+{
+  return Make().template to_array<Make().size()>();
+}
+
+namespace pmr {
+  /// @brief `List_` allocating its nodes from a `std::pmr::memory_resource`
+  template <typename T, error_policy Policy = policy::Apologize, stats_policy Stats = stats::None>
+  using List_ = ::List_<T, std::pmr::polymorphic_allocator<T>, Policy, Stats>;
+} // namespace pmr
+
+#endif // LIST_HPP
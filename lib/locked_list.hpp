@@ -0,0 +1,305 @@
+/**
+* @file locked_list.hpp
+* @brief `Locked_list_`, a thread safe doubly linked list locking only the nodes a mutation touches,
+*   so writers in different parts of the list run in parallel and readers never lock
+*/
+
+#ifndef LOCKED_LIST_HPP
+#define LOCKED_LIST_HPP
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include "epoch.hpp"
+
+
+/**
+* @brief lazy list with optimistic validation: a writer finds its spot without locking,
+*   locks the neighbours it relinks in list order, checks they are still live and adjacent,
+*   and starts over if not. Removal marks the node before unlinking it so readers, which
+*   traverse lock-free under an `ebr::Guard`, skip it; unlinked nodes are reclaimed through `ebr`
+*
+* elements are immutable once pushed, nodes come from the global heap because reclamation
+* may outlive the list
+*/
+template <typename T>
+class Locked_list_
+{
+  struct Node {
+    std::atomic<Node *> m_next    = {nullptr};
+    std::atomic<Node *> m_prev    = {nullptr};
+    std::atomic<bool>   m_marked  = {false}; // logically removed
+    std::atomic_flag    m_lock;
+    const bool          m_filled;
+    union { T m_data; };
+    //
+    Node() noexcept : m_filled(false) {}
+    template <typename ...Args>
+    explicit Node(Args&& ...args) : m_filled(true), m_data(std::forward<Args>(args)...) {}
+    //
+    ~Node() { if ( m_filled ) { std::destroy_at(std::addressof(m_data)); } }
+    //
+    auto lock() noexcept -> void {
+      while ( m_lock.test_and_set(std::memory_order_acquire) ) { m_lock.wait(true, std::memory_order_relaxed); }
+    }
+    auto unlock() noexcept -> void {
+      m_lock.clear(std::memory_order_release);
+      m_lock.notify_one();
+    }
+  }; // end of struct Node
+
+  Node                     *m_head  = {nullptr}; // sentinels, never removed
+  Node                     *m_tail  = {nullptr};
+  std::atomic<std::size_t>  m_size  = {0};
+
+  static auto delete_node(void *node)
+      -> void
+  {
+    delete static_cast<Node *>(node);
+  }
+
+  /// @brief true when `prev` and `next` are both live and still adjacent, both must be locked
+  [[nodiscard]] static auto adjacent(const Node *prev, const Node *next)
+      noexcept -> bool
+  {
+    return !prev->m_marked.load(std::memory_order_relaxed)
+        && !next->m_marked.load(std::memory_order_relaxed)
+        && prev->m_next.load(std::memory_order_relaxed) == next;
+  }
+
+  /// @brief links `node` between the locked, validated `prev` and `next`
+  auto link_between(Node *prev, Node *node, Node *next)
+      noexcept -> void
+  {
+    node->m_next.store(next, std::memory_order_relaxed);
+    node->m_prev.store(prev, std::memory_order_relaxed);
+    prev->m_next.store(node, std::memory_order_release); // publishes `node` to readers
+    next->m_prev.store(node, std::memory_order_release);
+    m_size.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// @brief first live node holding `value` or null, must run under a guard
+  [[nodiscard]] auto find_node(const T& value) const
+      -> Node *
+  {
+    for (Node *it = m_head->m_next.load(std::memory_order_acquire); it != m_tail;
+         it = it->m_next.load(std::memory_order_acquire)) {
+      if ( !it->m_marked.load(std::memory_order_acquire) && it->m_data == value ) { return it; }
+    }
+    return nullptr;
+  }
+
+  /// @brief links `node` right after the live `prev` found by `locate()`, retrying until `prev` stays valid
+  template <typename Locate>
+  auto link_after(Locate locate, Node *node)
+      -> bool
+  {
+    const ebr::Guard guard;
+    while ( true ) {
+      Node *prev = locate();
+      if ( prev == nullptr ) { delete node; return false; }
+      Node *next = prev->m_next.load(std::memory_order_acquire);
+      const std::lock_guard lock_prev(*prev);
+      const std::lock_guard lock_next(*next);
+      if ( adjacent(prev, next) ) { link_between(prev, node, next); return true; }
+    }
+  }
+
+  /// @brief links `node` right before the live `next` found by `locate()`, retrying until `next` stays valid
+  template <typename Locate>
+  auto link_before(Locate locate, Node *node)
+      -> bool
+  {
+    const ebr::Guard guard;
+    while ( true ) {
+      Node *next = locate();
+      if ( next == nullptr ) { delete node; return false; }
+      Node *prev = next->m_prev.load(std::memory_order_acquire);
+      const std::lock_guard lock_prev(*prev);
+      const std::lock_guard lock_next(*next);
+      if ( adjacent(prev, next) ) { link_between(prev, node, next); return true; }
+    }
+  }
+
+public:
+
+  using value_type  = T;
+  using size_type   = std::size_t;
+
+  /* constructors */
+  Locked_list_()
+    : m_head(new Node), m_tail(new Node) {
+    m_head->m_next.store(m_tail, std::memory_order_relaxed);
+    m_tail->m_prev.store(m_head, std::memory_order_relaxed);
+  }
+  //
+  Locked_list_(const Locked_list_&)             = delete;
+  Locked_list_& operator=(const Locked_list_&)  = delete;
+  //
+  /// @brief no other thread may use the list anymore
+  ~Locked_list_() {
+    Node *it = m_head;
+    while ( it != nullptr ) {
+      Node *next = it->m_next.load(std::memory_order_relaxed);
+      delete it;
+      it = next;
+    }
+  }
+
+  /**
+  * @brief number of elements, exact when no mutation is in flight
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  auto size() const noexcept
+      -> std::size_t
+  {
+    return m_size.load(std::memory_order_relaxed);
+  }
+
+  /**
+  * @brief check if empty
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  auto is_empty() const noexcept
+      -> bool
+  {
+    return size() == 0;
+  }
+
+  /**
+  * @brief add element at the end, locks the last node and the tail sentinel
+  * @complexity O(1) amortized
+  */
+  auto push_back(const T &arg)
+      -> void
+  {
+    (void)link_before([this] { return m_tail; }, new Node(arg));
+  }
+
+  /**
+  * @brief add element at the beginning, locks the head sentinel and the first node
+  * @complexity O(1) amortized
+  */
+  auto push_front(const T &arg)
+      -> void
+  {
+    (void)link_after([this] { return m_head; }, new Node(arg));
+  }
+
+  /**
+  * @brief inserts `val` after an element equal to `after`
+  * @complexity O(n) to find it, only the two nodes around the gap are locked
+  * @return false when no element equals `after`
+  */
+  auto push_after_value(const T &after, const T &val)
+      -> bool
+  {
+    return link_after([&] { return find_node(after); }, new Node(val));
+  }
+
+  /**
+  * @brief inserts `val` before an element equal to `before`
+  * @complexity O(n) to find it, only the two nodes around the gap are locked
+  * @return false when no element equals `before`
+  */
+  auto push_before_value(const T &before, const T &val)
+      -> bool
+  {
+    return link_before([&] { return find_node(before); }, new Node(val));
+  }
+
+  /**
+  * @brief removes every element equal to `value` in one pass, each removal locks
+  *   the node and its two neighbours
+  * @complexity O(n)
+  * @return number of removed elements
+  */
+  auto remove(const T &value)
+      -> std::size_t
+  {
+    const ebr::Guard guard;
+    std::size_t removed = 0;
+    Node       *it      = m_head->m_next.load(std::memory_order_acquire);
+    while ( it != m_tail ) {
+      if ( it->m_marked.load(std::memory_order_acquire) || !(it->m_data == value) ) {
+        it = it->m_next.load(std::memory_order_acquire);
+        continue;
+      }
+      Node *prev = it->m_prev.load(std::memory_order_acquire);
+      Node *next = it->m_next.load(std::memory_order_acquire);
+      {
+        const std::lock_guard lock_prev(*prev);
+        const std::lock_guard lock_it(*it);
+        const std::lock_guard lock_next(*next);
+        if ( !adjacent(prev, it) || !adjacent(it, next) ) { continue; } // moved under us, look again
+        it->m_marked.store(true, std::memory_order_release);
+        prev->m_next.store(next, std::memory_order_release);
+        next->m_prev.store(prev, std::memory_order_release);
+      }
+      m_size.fetch_sub(1, std::memory_order_relaxed);
+      ebr::retire(it, &delete_node);
+      ++removed;
+      it = next;
+    }
+    return removed;
+  }
+
+  /// @brief pop certain value/s from list
+  auto pop_value(const T &val)
+      -> void
+  {
+    (void)remove(val);
+  }
+
+  /**
+  * @brief calls `fn` on every live element without locking
+  * @complexity O(n)
+  */
+  template <typename Fn>
+    requires std::invocable<Fn&, const T&>
+  auto for_each(Fn fn) const
+      -> void
+  {
+    const ebr::Guard guard;
+    for (const Node *it = m_head->m_next.load(std::memory_order_acquire); it != m_tail;
+         it = it->m_next.load(std::memory_order_acquire)) {
+      if ( !it->m_marked.load(std::memory_order_acquire) ) { fn(std::as_const(it->m_data)); }
+    }
+  }
+
+  /**
+  * @brief calls `fn` on every live element from the back, following the `m_prev` links, without locking
+  * @complexity O(n)
+  */
+  template <typename Fn>
+    requires std::invocable<Fn&, const T&>
+  auto for_each_reverse(Fn fn) const
+      -> void
+  {
+    const ebr::Guard guard;
+    for (const Node *it = m_tail->m_prev.load(std::memory_order_acquire); it != m_head;
+         it = it->m_prev.load(std::memory_order_acquire)) {
+      if ( !it->m_marked.load(std::memory_order_acquire) ) { fn(std::as_const(it->m_data)); }
+    }
+  }
+
+  /**
+  * @brief search for a value without locking
+  * @complexity O(n)
+  * @param target
+  */
+  [[nodiscard]]
+  auto search(const T &target) const
+      -> bool
+  {
+    const ebr::Guard guard;
+    return find_node(target) != nullptr;
+  }
+}; // end of class Locked_list_
+
+#endif // LOCKED_LIST_HPP
@@ -0,0 +1,235 @@
+/**
+* @file mapped_list.hpp
+* @brief `Mapped_list_`, a doubly linked list living in a memory mapped file: links are slot
+*   indices, that is offsets from the mapping base in units of one slot, so reopening the file
+*   gives the list back without reading or parsing anything, POSIX only
+*/
+
+#ifndef MAPPED_LIST_HPP
+#define MAPPED_LIST_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "apology.hpp"
+#include "index_linked.hpp"
+
+
+namespace detail {
+
+  /// @brief the start of a mapped list file, the slots follow at `mapped_header_bytes`
+  struct Mapped_header {
+    char          m_magic[8]  = {'D', 'L', 'S', 'T', 'M', 'A', 'P', '\0'};
+    std::uint32_t m_version   = 1;
+    std::uint32_t m_slot_size = {};
+    std::uint64_t m_capacity  = {};
+    // the list itself, every push / pop / sort writes it here directly
+    Index_links<std::uint32_t> m_links = {};
+  }; // end of struct Mapped_header
+
+  inline constexpr std::size_t mapped_header_bytes = 64;
+  static_assert(sizeof(Mapped_header) <= mapped_header_bytes && std::is_trivially_copyable_v<Mapped_header>);
+
+  /// @brief slots in a shared mapping of one file, extended in place by growing the file
+  template <typename T, typename Index>
+  class Mapped_slots
+  {
+    using slot_type = Index_slot<T, Index>;
+
+    static constexpr Index npos = std::numeric_limits<Index>::max();
+
+    int         m_fd    = {-1};
+    std::byte  *m_base  = {nullptr};
+    std::size_t m_bytes = {};
+
+    static constexpr auto bytes_for(const std::size_t capacity) noexcept -> std::size_t {
+      return mapped_header_bytes + capacity * sizeof(slot_type);
+    }
+
+    /// @brief maps the first `bytes` of the file, the old mapping if any stays until this succeeds
+    auto map(const std::size_t bytes)
+        -> void
+    {
+      void *base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+      if ( base == MAP_FAILED ) { throw std::system_error(errno, std::generic_category(), "mmap"); }
+      if ( m_base != nullptr ) { ::munmap(m_base, m_bytes); }
+      m_base  = static_cast<std::byte *>(base);
+      m_bytes = bytes;
+    }
+
+    auto close()
+        noexcept -> void
+    {
+      if ( m_base != nullptr ) { ::munmap(m_base, m_bytes); }
+      if ( m_fd >= 0 )         { ::close(m_fd); }
+      m_base  = nullptr;
+      m_fd    = -1;
+    }
+
+    /// @brief true when the mapped bytes hold a list of `T` this build can use and every link in the header points at a used slot
+    [[nodiscard]] auto valid()
+        const noexcept -> bool
+    {
+      if ( m_bytes < mapped_header_bytes ) { return false; }
+      const Mapped_header& h = header();
+      const Mapped_header expected;
+      const Index_links<Index>& l = h.m_links;
+      const auto in_use = [&l](const Index i) { return i == npos || i < l.m_used; };
+      return std::memcmp(h.m_magic, expected.m_magic, sizeof h.m_magic) == 0
+          && h.m_version   == expected.m_version
+          && h.m_slot_size == sizeof(slot_type)
+          && h.m_capacity  <= npos
+          && m_bytes       >= bytes_for(h.m_capacity)
+          && l.m_used      <= h.m_capacity
+          && l.m_size      <= l.m_used
+          && in_use(l.m_head) && in_use(l.m_tail) && in_use(l.m_free)
+          && (l.m_head == npos) == (l.m_size == 0)
+          && (l.m_tail == npos) == (l.m_size == 0);
+    }
+
+  public:
+    static constexpr bool growable = true;
+    //
+    /// @brief opens `path`, an empty or missing file becomes an empty list with room for `capacity`
+    Mapped_slots(const std::string& path, const std::size_t capacity)
+    {
+      m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+      if ( m_fd < 0 ) { throw std::system_error(errno, std::generic_category(), path); }
+      try {
+        struct stat st;
+        if ( ::fstat(m_fd, &st) != 0 ) { throw std::system_error(errno, std::generic_category(), path); }
+        if ( st.st_size == 0 ) {
+          const std::size_t slots = capacity == 0 ? 1 : std::min<std::size_t>(capacity, npos);
+          if ( ::ftruncate(m_fd, static_cast<off_t>(bytes_for(slots))) != 0 ) {
+            throw std::system_error(errno, std::generic_category(), path);
+          }
+          map(bytes_for(slots));
+          Mapped_header *h = ::new (m_base) Mapped_header{};
+          h->m_slot_size  = sizeof(slot_type);
+          h->m_capacity   = slots;
+        } else {
+          map(static_cast<std::size_t>(st.st_size));
+          if ( !valid() ) { throw std::runtime_error(path + ": not a mapped list of this element type, or a damaged one"); }
+        }
+      } catch (...) {
+        close();
+        throw;
+      }
+    }
+    //
+    Mapped_slots(Mapped_slots&& rhs) noexcept
+      : m_fd(std::exchange(rhs.m_fd, -1)),
+        m_base(std::exchange(rhs.m_base, nullptr)),
+        m_bytes(std::exchange(rhs.m_bytes, 0)) {}
+    //
+    Mapped_slots(const Mapped_slots&)             = delete;
+    Mapped_slots& operator=(const Mapped_slots&)  = delete;
+    //
+    ~Mapped_slots() { close(); }
+    //
+    auto header()       noexcept -> Mapped_header &       { return *std::launder(reinterpret_cast<Mapped_header *>(m_base)); }
+    auto header() const noexcept -> const Mapped_header & { return *std::launder(reinterpret_cast<const Mapped_header *>(m_base)); }
+    //
+    auto slots()       noexcept -> slot_type *       { return reinterpret_cast<slot_type *>(m_base + mapped_header_bytes); }
+    auto slots() const noexcept -> const slot_type * { return reinterpret_cast<const slot_type *>(m_base + mapped_header_bytes); }
+    //
+    auto capacity() const noexcept -> std::size_t { return header().m_capacity; }
+    //
+    /// @brief the list bookkeeping, in the header so it is in the file as soon as it changes
+    auto links()       noexcept -> Index_links<Index> &       { return header().m_links; }
+    auto links() const noexcept -> const Index_links<Index> & { return header().m_links; }
+    //
+    /// @brief grows the file to `n` slots and maps it again, slot contents stay, addresses may not
+    auto extend(const std::size_t n)
+        -> void
+    {
+      if ( ::ftruncate(m_fd, static_cast<off_t>(bytes_for(n))) != 0 ) {
+        throw std::system_error(errno, std::generic_category(), "ftruncate");
+      }
+      map(bytes_for(n));
+      header().m_capacity = n;
+    }
+    //
+    /// @brief writes the mapping back to the file, false when `msync` failed
+    auto sync()
+        noexcept -> bool
+    {
+      return ::msync(m_base, m_bytes, MS_SYNC) == 0;
+    }
+  }; // end of class Mapped_slots
+
+} // namespace detail
+
+/**
+* @brief same push/pop/at/search/sort api as `List_` over slots in a memory mapped file,
+*   elements and the head / tail / free list bookkeeping both live in the mapping, so the file
+*   holds the list as of the last finished operation even if the process dies, `sync()` only
+*   forces it to disk against a crash of the machine; the file grows by doubling, which keeps
+*   indices and iterators valid
+*
+* @tparam T element type, trivially copyable since its bytes outlive the process
+* @tparam Policy what happens on misuse, see `policy`
+*/
+template <typename T, error_policy Policy = policy::Apologize>
+class Mapped_list_
+  : public detail::Index_linked_<T, std::uint32_t, detail::Mapped_slots<T, std::uint32_t>, Policy>
+{
+  static_assert(std::is_trivially_copyable_v<T>, "a Mapped_list_ keeps raw bytes in a file, T must be trivially copyable");
+
+  using base = detail::Index_linked_<T, std::uint32_t, detail::Mapped_slots<T, std::uint32_t>, Policy>;
+
+public:
+
+  using index_type = std::uint32_t;
+
+  /**
+  * @brief opens the list stored in `path`, an empty or missing file starts an empty list with
+  *   room for `capacity` elements
+  * @throws std::system_error when the file cannot be opened, sized or mapped,
+  *   std::runtime_error when it holds something else
+  */
+  explicit Mapped_list_(const std::string& path, const std::size_t capacity = 1024)
+    : base(detail::Mapped_slots<T, std::uint32_t>(path, capacity)) {}
+  //
+  Mapped_list_(const Mapped_list_&)             = delete;
+  Mapped_list_& operator=(const Mapped_list_&)  = delete;
+  //
+  ~Mapped_list_() { sync(); }
+
+  /**
+  * @brief flushes the mapping, header included, to disk
+  * @complexity O(capacity) pages at worst, only dirty pages are written
+  * @return false when `msync` failed
+  */
+  auto sync()
+      noexcept -> bool
+  {
+    return this->m_storage.sync();
+  }
+
+  /**
+  * @brief grows the file to hold `n` elements without growing again, elements keep their slots
+  * @complexity O(1) plus the file system's work
+  */
+  auto reserve(const std::size_t n)
+      -> void
+  {
+    if ( this->fails(n > base::npos, Apology::full) ) { return; }
+    if ( n > this->m_storage.capacity() ) { this->grow(n); }
+  }
+}; // end of class Mapped_list_
+
+#endif // MAPPED_LIST_HPP
@@ -0,0 +1,282 @@
+/**
+* @file parallel.hpp
+* @brief parallel for_each/transform/reduce/count_if/sort over `List_`: one pass cuts the list
+*   into about equal segments, a thread pool works on them, the results are combined in order
+*/
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "list.hpp"
+
+
+namespace par {
+
+/**
+* @brief fixed set of worker threads draining one task queue, the thread asking for work
+*   helps with it, so calling back into the pool from a task cannot deadlock
+*/
+class Thread_pool
+{
+  std::vector<std::thread>          m_workers;
+  std::deque<std::function<void()>> m_tasks;
+  std::mutex                        m_mutex;
+  std::condition_variable           m_ready;
+  bool                              m_stop = {false};
+
+  auto work()
+      -> void
+  {
+    while ( true ) {
+      std::function<void()> task;
+      {
+        std::unique_lock lock(m_mutex);
+        m_ready.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+        if ( m_tasks.empty() ) { return; }
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+      }
+      task();
+    }
+  }
+
+public:
+
+  /// @param workers threads besides the callers, zero runs everything on the caller
+  explicit Thread_pool(const std::size_t workers) {
+    m_workers.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) { m_workers.emplace_back([this] { work(); }); }
+  }
+  //
+  Thread_pool(const Thread_pool&)             = delete;
+  Thread_pool& operator=(const Thread_pool&)  = delete;
+  //
+  ~Thread_pool() {
+    {
+      const std::lock_guard lock(m_mutex);
+      m_stop = true;
+    }
+    m_ready.notify_all();
+    for (auto& worker : m_workers) { worker.join(); }
+  }
+
+  /// @brief number of threads that can work at once, the caller included
+  [[nodiscard]] auto concurrency()
+      const noexcept -> std::size_t
+  {
+    return m_workers.size() + 1;
+  }
+
+  /**
+  * @brief runs `fn(0) .. fn(n - 1)` spread over the workers and the caller, returns when all are done
+  * @param n
+  * @param fn may throw: every index still runs, then the first exception is rethrown here,
+  *   so nothing `fn` captured is used once `run` has left
+  */
+  template <typename Fn>
+  auto run(const std::size_t n, Fn fn)
+      -> void
+  {
+    // shared so late helpers that find nothing left never touch a dead frame
+    struct Batch {
+      Fn                        m_fn;
+      std::size_t               m_n;
+      std::atomic<std::size_t>  m_next   = {0};
+      std::atomic<std::size_t>  m_done   = {0};
+      std::atomic_flag          m_failed = {};
+      std::exception_ptr        m_error  = {}; // the first throw, published by the `m_done` increment after it
+      //
+      auto drain() -> void {
+        for (std::size_t i = m_next++; i < m_n; i = m_next++) {
+          try {
+            m_fn(i);
+          } catch (...) {
+            if ( !m_failed.test_and_set() ) { m_error = std::current_exception(); }
+          }
+          if ( ++m_done == m_n ) { m_done.notify_all(); }
+        }
+      }
+    };
+    const auto batch = std::make_shared<Batch>(std::move(fn), n);
+    {
+      const std::lock_guard lock(m_mutex);
+      for (std::size_t i = 1; i < std::min(n, concurrency()); ++i) { m_tasks.emplace_back([batch] { batch->drain(); }); }
+    }
+    m_ready.notify_all();
+    batch->drain();
+    for (std::size_t done = batch->m_done.load(); done != n; done = batch->m_done.load()) { batch->m_done.wait(done); }
+    if ( batch->m_error ) { std::rethrow_exception(batch->m_error); }
+  }
+}; // end of class Thread_pool
+
+/// @brief the pool used when none is given, one thread per core
+inline auto default_pool()
+    -> Thread_pool&
+{
+  static Thread_pool pool( std::max(1u, std::thread::hardware_concurrency()) - 1 );
+  return pool;
+}
+
+/// @brief lists shorter than this per thread are not worth splitting
+inline constexpr std::size_t min_segment = 4096;
+
+namespace detail {
+
+  /// @brief how many segments `size` elements are cut into on `pool`
+  [[nodiscard]] inline auto segment_count(const std::size_t size, const Thread_pool& pool)
+      noexcept -> std::size_t
+  {
+    return std::clamp<std::size_t>(size / min_segment, 1, pool.concurrency());
+  }
+
+  /**
+  * @brief one pass over the list collecting `parts + 1` iterators, segment `i` is [bounds[i], bounds[i + 1])
+  * @complexity O(n)
+  */
+  template <typename List, typename Iter = decltype(std::declval<List&>().begin())>
+  auto segment_bounds(List& list, const std::size_t parts)
+      -> std::vector<Iter>
+  {
+    std::vector<Iter> bounds;
+    bounds.reserve(parts + 1);
+    Iter              it   = list.begin();
+    const std::size_t size = list.size();
+    for (std::size_t part = 0, pos = 0; part < parts; ++part) {
+      bounds.push_back(it);
+      const std::size_t stop = size * (part + 1) / parts;
+      for (; pos < stop; ++pos) { ++it; }
+    }
+    bounds.push_back(list.end());
+    return bounds;
+  }
+
+} // namespace detail
+
+/**
+* @brief calls `fn(element)` on every element, segments run in parallel
+* @complexity O(n / threads) plus one O(n) pass to cut the segments
+*/
+template <typename T, typename Alloc, typename Policy, typename Stats, typename Fn>
+  requires std::invocable<Fn&, T&>
+auto for_each(List_<T, Alloc, Policy, Stats>& list, Fn fn, Thread_pool& pool = default_pool())
+    -> void
+{
+  const std::size_t parts = detail::segment_count(list.size(), pool);
+  if ( parts == 1 ) { std::for_each(list.begin(), list.end(), fn); return; }
+  const auto bounds = detail::segment_bounds(list, parts);
+  pool.run(parts, [&](const std::size_t i) { std::for_each(bounds[i], bounds[i + 1], fn); });
+}
+
+/**
+* @brief replaces every element `x` with `fn(x)`, segments run in parallel
+* @complexity O(n / threads) plus one O(n) pass to cut the segments
+*/
+template <typename T, typename Alloc, typename Policy, typename Stats, typename Fn>
+  requires std::invocable<Fn&, const T&> && std::assignable_from<T&, std::invoke_result_t<Fn&, const T&>>
+auto transform(List_<T, Alloc, Policy, Stats>& list, Fn fn, Thread_pool& pool = default_pool())
+    -> void
+{
+  par::for_each(list, [&fn](T& x) { x = fn(std::as_const(x)); }, pool);
+}
+
+/**
+* @brief folds the list into `init` with the associative `op`, segments are folded in parallel
+*   and their results combined in list order, so `op` does not need to be commutative
+* @complexity O(n / threads) plus one O(n) pass to cut the segments
+*/
+template <typename T, typename Alloc, typename Policy, typename Stats, typename Op = std::plus<>>
+  requires std::invocable<Op&, const T&, const T&>
+auto reduce(const List_<T, Alloc, Policy, Stats>& list, T init, Op op = {}, Thread_pool& pool = default_pool())
+    -> T
+{
+  const std::size_t parts = detail::segment_count(list.size(), pool);
+  if ( parts == 1 ) { return std::accumulate(list.begin(), list.end(), std::move(init), op); }
+  const auto bounds = detail::segment_bounds(list, parts);
+  std::vector<std::optional<T>> partial(parts);
+  pool.run(parts, [&](const std::size_t i) {
+    auto it = bounds[i];
+    T acc = *it;
+    for (++it; it != bounds[i + 1]; ++it) { acc = op(std::as_const(acc), *it); }
+    partial[i].emplace(std::move(acc));
+  });
+  for (auto& p : partial) { init = op(std::as_const(init), std::as_const(*p)); }
+  return init;
+}
+
+/**
+* @brief number of elements satisfying `pred`, segments are counted in parallel
+* @complexity O(n / threads) plus one O(n) pass to cut the segments
+*/
+template <typename T, typename Alloc, typename Policy, typename Stats, typename Pred>
+  requires std::predicate<Pred&, const T&>
+auto count_if(const List_<T, Alloc, Policy, Stats>& list, Pred pred, Thread_pool& pool = default_pool())
+    -> std::size_t
+{
+  const std::size_t parts = detail::segment_count(list.size(), pool);
+  if ( parts == 1 ) { return static_cast<std::size_t>(std::count_if(list.begin(), list.end(), pred)); }
+  const auto bounds = detail::segment_bounds(list, parts);
+  std::vector<std::size_t> partial(parts);
+  pool.run(parts, [&](const std::size_t i) {
+    partial[i] = static_cast<std::size_t>(std::count_if(bounds[i], bounds[i + 1], pred));
+  });
+  return std::accumulate(partial.begin(), partial.end(), std::size_t{0});
+}
+
+/**
+* @brief stable sort: the list is cut into segments with `split_at`, each is sorted on its own
+*   thread, then neighbours are merged pairwise in parallel rounds with `merge_sorted`,
+*   nodes are only relinked; when `comp` throws, the exception reaches the caller with every
+*   element back in the list, in unspecified order
+* @complexity O(n log(n) / threads + n log(threads))
+*/
+template <typename T, typename Alloc, typename Policy, typename Stats, typename Compare = std::less<>>
+  requires std::predicate<Compare&, const T&, const T&>
+auto sort(List_<T, Alloc, Policy, Stats>& list, Compare comp = {}, Thread_pool& pool = default_pool())
+    -> void
+{
+  const std::size_t parts = detail::segment_count(list.size(), pool);
+  if ( parts == 1 ) {
+    if ( !list.is_empty() ) { list.sort(comp); }
+    return;
+  }
+  auto bounds = detail::segment_bounds(list, parts);
+  std::vector<List_<T, Alloc, Policy, Stats>> segments;
+  segments.reserve(parts);
+  for (std::size_t i = parts; i-- > 1; ) { segments.push_back(list.split_at(bounds[i])); } // back to front
+  segments.push_back(std::move(list));
+  std::reverse(segments.begin(), segments.end());
+  //
+  try {
+    pool.run(parts, [&](const std::size_t i) { segments[i].sort(comp); });
+    for (std::size_t step = 1; step < parts; step *= 2) {
+      pool.run((parts + 2 * step - 1) / (2 * step), [&](const std::size_t i) {
+        const std::size_t left = 2 * step * i;
+        if ( left + step < parts ) { segments[left].merge_sorted(std::move(segments[left + step]), comp); }
+      });
+    }
+  } catch (...) {
+    for (std::size_t i = 1; i < parts; ++i) { segments.front().concat(std::move(segments[i])); }
+    list = std::move(segments.front());
+    throw;
+  }
+  list = std::move(segments.front());
+}
+
+} // namespace par
+
+#endif // PARALLEL_HPP
@@ -0,0 +1,501 @@
+/**
+* @file persistent_list.hpp
+* @brief `Persistent_list_`, a list whose `snapshot()` is O(1): elements sit in reference counted
+*   chunks under a reference counted spine, a snapshot shares both, and the next write copies
+*   only the spine and the one chunk it touches, so readers keep a stable immutable view while
+*   the writer carries on
+*/
+
+#ifndef PERSISTENT_LIST_HPP
+#define PERSISTENT_LIST_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+#include "apology.hpp"
+#include "list.hpp"
+
+
+namespace detail {
+
+  /**
+  * @brief owns a `V` shared by reference count, `mut()` copies it first when anyone else
+  *   holds it, counts are atomic so copies may live on other threads
+  */
+  template <typename V>
+  class Cow
+  {
+    struct Box {
+      std::atomic<std::size_t> m_refs = {1};
+      V                        m_value;
+      //
+      template <typename ...Args>
+      explicit Box(Args&& ...args) : m_value(std::forward<Args>(args)...) {}
+    }; // end of struct Box
+
+    Box *m_box = {nullptr};
+
+  public:
+    Cow() noexcept = default;
+    //
+    template <typename ...Args>
+    [[nodiscard]] static auto make(Args&& ...args) -> Cow {
+      Cow cow;
+      cow.m_box = new Box(std::forward<Args>(args)...);
+      return cow;
+    }
+    //
+    Cow(const Cow& rhs) noexcept : m_box(rhs.m_box) {
+      if ( m_box != nullptr ) { m_box->m_refs.fetch_add(1, std::memory_order_relaxed); }
+    }
+    Cow(Cow&& rhs) noexcept : m_box(std::exchange(rhs.m_box, nullptr)) {}
+    //
+    auto operator=(Cow rhs) noexcept -> Cow& { std::swap(m_box, rhs.m_box); return *this; }
+    //
+    ~Cow() {
+      if ( m_box != nullptr && m_box->m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1 ) { delete m_box; }
+    }
+    //
+    explicit operator bool() const noexcept { return m_box != nullptr; }
+    //
+    [[nodiscard]] auto get() const noexcept -> const V & { return m_box->m_value; }
+    //
+    /// @brief the value for writing, a private copy when it was shared
+    [[nodiscard]] auto mut()
+        -> V &
+    {
+      if ( m_box->m_refs.load(std::memory_order_acquire) != 1 ) { *this = make(std::as_const(m_box->m_value)); }
+      return m_box->m_value;
+    }
+  }; // end of class Cow
+
+  /**
+  * @brief the read only half of `Persistent_list_`, also what `snapshot()` hands out:
+  *   a spine of chunks plus the element count, never changes once made
+  */
+  template <typename T, typename Policy>
+  class Cow_view : protected Failed_slot_for<T, Policy>
+  {
+  protected:
+
+    using chunk_type = std::vector<T>;
+    using spine_type = std::vector<Cow<chunk_type>>;
+
+    Cow<spine_type> m_spine;
+    std::size_t     m_size = {};
+
+    using Failed_slot_for<T, Policy>::failed;
+
+    /// @brief true when the operation must bail out, see `detail::fails`
+    [[nodiscard]] static constexpr auto fails(const bool bad, const Apology apology)
+        -> bool
+    {
+      return detail::fails<Policy>(bad, apology);
+    }
+
+    /// @brief chunk and offset of the element at `pos < size()`
+    [[nodiscard]] auto find(std::size_t pos) const
+        noexcept -> std::pair<std::size_t, std::size_t>
+    {
+      const spine_type& spine = m_spine.get();
+      std::size_t i = 0;
+      while ( pos >= spine[i].get().size() ) { pos -= spine[i].get().size(); ++i; }
+      return {i, pos};
+    }
+
+  public:
+
+    /**
+    * @brief bidirectional iterator over the chunks, stays valid as long as the view it came from
+    */
+    class const_iterator {
+      friend class Cow_view;
+      //
+      const spine_type *m_spine   = {nullptr};
+      std::size_t       m_chunk   = {};
+      std::size_t       m_offset  = {};
+      //
+      const_iterator(const spine_type *spine, const std::size_t chunk, const std::size_t offset) noexcept
+        : m_spine(spine), m_chunk(chunk), m_offset(offset) {}
+    public:
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type        = T;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = const T *;
+      using reference         = const T &;
+      //
+      const_iterator() noexcept = default;
+      //
+      bool operator==(const const_iterator& rhs) const noexcept {
+        return m_chunk == rhs.m_chunk && m_offset == rhs.m_offset;
+      }
+      //
+      reference operator*()  const noexcept { return (*m_spine)[m_chunk].get()[m_offset]; }
+      pointer   operator->() const noexcept { return std::addressof(**this); }
+      //
+      const_iterator& operator++() noexcept {
+        if ( ++m_offset == (*m_spine)[m_chunk].get().size() ) { ++m_chunk; m_offset = 0; }
+        return *this;
+      }
+      const_iterator& operator--() noexcept {
+        if ( m_offset == 0 ) { --m_chunk; m_offset = (*m_spine)[m_chunk].get().size(); }
+        --m_offset;
+        return *this;
+      }
+      const_iterator operator++(int) noexcept { const_iterator old = *this; ++*this; return old; }
+      const_iterator operator--(int) noexcept { const_iterator old = *this; --*this; return old; }
+    }; // end of class const_iterator
+
+    using value_type              = T;
+    using size_type               = std::size_t;
+    using difference_type         = std::ptrdiff_t;
+    using const_reference         = const T &;
+    using const_reverse_iterator  = std::reverse_iterator<const_iterator>;
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+      return m_size == 0 ? const_iterator() : const_iterator(&m_spine.get(), 0, 0);
+    }
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+      return m_size == 0 ? const_iterator() : const_iterator(&m_spine.get(), m_spine.get().size(), 0);
+    }
+    [[nodiscard]] auto cbegin()  const noexcept -> const_iterator         { return begin(); }
+    [[nodiscard]] auto cend()    const noexcept -> const_iterator         { return end(); }
+    [[nodiscard]] auto rbegin()  const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+    [[nodiscard]] auto rend()    const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+
+    /**
+    * @brief check if list is empty
+    * @complexity O(1)
+    */
+    [[nodiscard]] auto is_empty() const noexcept -> bool { return m_size == 0; }
+
+    /**
+    * @brief get list size
+    * @complexity O(1)
+    */
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size; }
+
+    /**
+    * @brief first element
+    * @complexity O(1)
+    */
+    [[nodiscard]]
+    auto front() const
+        -> const T &
+    {
+      if ( fails(is_empty(), Apology::empty) ) { return failed(); }
+      return m_spine.get().front().get().front();
+    }
+
+    /**
+    * @brief last element
+    * @complexity O(1)
+    */
+    [[nodiscard]]
+    auto back() const
+        -> const T &
+    {
+      if ( fails(is_empty(), Apology::empty) ) { return failed(); }
+      return m_spine.get().back().get().back();
+    }
+
+    /**
+    * @brief element at given position
+    * @complexity O(size / chunk size)
+    */
+    [[nodiscard]]
+    auto at(const std::size_t pos) const
+        -> const T &
+    {
+      if ( fails(is_empty(), Apology::empty) ) { return failed(); }
+      if ( fails(pos >= m_size, Apology::invalid_position) ) { return failed(); }
+      const auto [chunk, offset] = find(pos);
+      return m_spine.get()[chunk].get()[offset];
+    }
+
+    /**
+    * @brief check if `value` is in the list
+    * @complexity O(n)
+    */
+    [[nodiscard]] auto search(const T& value) const -> bool { return locate(value) != -1; }
+
+    /**
+    * @brief position of the first element equal to `value`, -1 when there is none
+    * @complexity O(n)
+    */
+    [[nodiscard]]
+    auto locate(const T& value) const
+        -> std::int64_t
+    {
+      if ( is_empty() ) { return -1; }
+      std::int64_t base = 0;
+      for (const Cow<chunk_type>& chunk : m_spine.get()) {
+        const auto it = std::find(chunk.get().begin(), chunk.get().end(), value);
+        if ( it != chunk.get().end() ) { return base + (it - chunk.get().begin()); }
+        base += static_cast<std::int64_t>(chunk.get().size());
+      }
+      return -1;
+    }
+  }; // end of class Cow_view
+
+} // namespace detail
+
+/**
+* @brief push/pop/at/search api of `List_` over chunks of up to `chunk_size` elements shared
+*   copy on write: `snapshot()` and copies are O(1) and never see later writes, a write after
+*   one copies the spine ( O(size / chunk_size) handles ) and the chunk it lands in;
+*   one writer at a time, snapshots may be read and dropped on any thread
+*
+* @tparam T element type, copyable
+* @tparam Policy what happens on misuse, see `policy`
+*/
+template <std::copyable T, error_policy Policy = policy::Apologize>
+class Persistent_list_ : public detail::Cow_view<T, Policy>
+{
+  using view = detail::Cow_view<T, Policy>;
+  using typename view::chunk_type;
+  using typename view::spine_type;
+  using view::m_spine;
+  using view::m_size;
+  using view::fails;
+  using view::failed;
+  using view::find;
+
+  /// @brief the spine for writing, created on first use
+  auto spine()
+      -> spine_type &
+  {
+    if ( !m_spine ) { m_spine = detail::Cow<spine_type>::make(); }
+    return m_spine.mut();
+  }
+
+  /// @brief a new chunk holding `value`, with room for a full chunk
+  static auto chunk_with(T value)
+      -> detail::Cow<chunk_type>
+  {
+    auto chunk = detail::Cow<chunk_type>::make();
+    chunk.mut().reserve(chunk_size);
+    chunk.mut().push_back(std::move(value));
+    return chunk;
+  }
+
+  /// @brief drops chunk `i` of `s` when it ran empty
+  auto drop_if_empty(spine_type& s, const std::size_t i)
+      -> void
+  {
+    if ( s[i].get().empty() ) { s.erase(s.begin() + static_cast<std::ptrdiff_t>(i)); }
+  }
+
+public:
+
+  /// @brief most elements one chunk holds, about 1 KiB of them
+  static constexpr std::size_t chunk_size = std::max<std::size_t>(4, 1024 / sizeof(T));
+
+  using snapshot_type = view;
+
+  using typename view::const_iterator;
+
+  /* constructors */
+  Persistent_list_() = default;
+  //
+  Persistent_list_(std::initializer_list<T> values) {
+    for (const T& v : values) { push_back(v); }
+  }
+  //
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+  Persistent_list_(from_range_t, R&& range) {
+    for (auto&& v : range) { push_back(T(std::forward<decltype(v)>(v))); }
+  }
+
+  /**
+  * @brief an immutable view of the list as it is now, later writes do not reach it
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  auto snapshot() const
+      -> snapshot_type
+  {
+    return *this;
+  }
+
+  /**
+  * @brief a list sharing nothing with this one, every chunk copied
+  * @complexity O(n)
+  */
+  [[nodiscard]]
+  auto clone() const
+      -> Persistent_list_
+  {
+    Persistent_list_ copy;
+    if ( m_spine ) {
+      spine_type& s = copy.spine();
+      s.reserve(m_spine.get().size());
+      for (const auto& chunk : m_spine.get()) { s.push_back(detail::Cow<chunk_type>::make(chunk.get())); }
+    }
+    copy.m_size = m_size;
+    return copy;
+  }
+
+  using view::front;
+  using view::back;
+  using view::at;
+
+  /**
+  * @brief first element, for writing
+  * @complexity O(1), O(chunk size + size / chunk size) when shared
+  */
+  [[nodiscard]]
+  auto front()
+      -> T &
+  {
+    if ( fails(this->is_empty(), Apology::empty) ) { return failed(); }
+    return spine().front().mut().front();
+  }
+
+  /**
+  * @brief last element, for writing
+  * @complexity O(1), O(chunk size + size / chunk size) when shared
+  */
+  [[nodiscard]]
+  auto back()
+      -> T &
+  {
+    if ( fails(this->is_empty(), Apology::empty) ) { return failed(); }
+    return spine().back().mut().back();
+  }
+
+  /**
+  * @brief element at given position, for writing
+  * @complexity O(size / chunk size + chunk size)
+  */
+  [[nodiscard]]
+  auto at(const std::size_t pos)
+      -> T &
+  {
+    if ( fails(this->is_empty(), Apology::empty) ) { return failed(); }
+    if ( fails(pos >= m_size, Apology::invalid_position) ) { return failed(); }
+    const auto [chunk, offset] = find(pos);
+    return spine()[chunk].mut()[offset];
+  }
+
+  /**
+  * @brief add element at end of list
+  * @complexity O(1), O(chunk size + size / chunk size) when shared
+  */
+  auto push_back(T value)
+      -> void
+  {
+    spine_type& s = spine();
+    if ( s.empty() || s.back().get().size() == chunk_size ) { s.push_back(chunk_with(std::move(value))); }
+    else                                                     { s.back().mut().push_back(std::move(value)); }
+    ++m_size;
+  }
+
+  /**
+  * @brief add element at the beginning of list
+  * @complexity O(chunk size + size / chunk size)
+  */
+  auto push_front(T value)
+      -> void
+  {
+    spine_type& s = spine();
+    if ( s.empty() || s.front().get().size() == chunk_size ) { s.insert(s.begin(), chunk_with(std::move(value))); }
+    else { chunk_type& c = s.front().mut(); c.insert(c.begin(), std::move(value)); }
+    ++m_size;
+  }
+
+  /**
+  * @brief add element at given position, like `List_` the first position prepends and the
+  *   last appends, a full chunk is split in two
+  * @complexity O(size / chunk size + chunk size)
+  */
+  auto push_at(const std::size_t pos, T value)
+      -> void
+  {
+    if ( fails(pos >= m_size, Apology::invalid_position) ) { return; }
+    if ( pos == 0 )          { push_front(std::move(value)); return; }
+    if ( pos == m_size - 1 ) { push_back(std::move(value)); return; }
+    auto [i, offset] = find(pos);
+    spine_type& s = spine();
+    if ( s[i].get().size() == chunk_size ) {
+      const std::size_t half = chunk_size / 2;
+      chunk_type& full = s[i].mut();
+      auto tail = detail::Cow<chunk_type>::make();
+      tail.mut().reserve(chunk_size);
+      tail.mut().assign(std::make_move_iterator(full.begin() + half), std::make_move_iterator(full.end()));
+      full.erase(full.begin() + half, full.end());
+      s.insert(s.begin() + static_cast<std::ptrdiff_t>(i) + 1, std::move(tail));
+      if ( offset >= half ) { ++i; offset -= half; }
+    }
+    chunk_type& c = s[i].mut();
+    c.insert(c.begin() + static_cast<std::ptrdiff_t>(offset), std::move(value));
+    ++m_size;
+  }
+
+  /**
+  * @brief remove last element
+  * @complexity O(1), O(chunk size + size / chunk size) when shared
+  */
+  auto pop_back()
+      -> void
+  {
+    if ( fails(this->is_empty(), Apology::empty) ) { return; }
+    spine_type& s = spine();
+    s.back().mut().pop_back();
+    drop_if_empty(s, s.size() - 1);
+    --m_size;
+  }
+
+  /**
+  * @brief remove first element
+  * @complexity O(chunk size + size / chunk size)
+  */
+  auto pop_front()
+      -> void
+  {
+    if ( fails(this->is_empty(), Apology::empty) ) { return; }
+    spine_type& s = spine();
+    chunk_type& c = s.front().mut();
+    c.erase(c.begin());
+    drop_if_empty(s, 0);
+    --m_size;
+  }
+
+  /**
+  * @brief remove element at given position
+  * @complexity O(size / chunk size + chunk size)
+  */
+  auto pop_at(const std::size_t pos)
+      -> void
+  {
+    if ( fails(this->is_empty(), Apology::empty) ) { return; }
+    if ( fails(pos >= m_size, Apology::invalid_position) ) { return; }
+    const auto [i, offset] = find(pos);
+    spine_type& s = spine();
+    chunk_type& c = s[i].mut();
+    c.erase(c.begin() + static_cast<std::ptrdiff_t>(offset));
+    drop_if_empty(s, i);
+    --m_size;
+  }
+
+  /**
+  * @brief erases the list, snapshots keep their elements
+  * @complexity O(1) when shared, O(n) otherwise
+  */
+  auto clear()
+      noexcept -> void
+  {
+    m_spine = {};
+    m_size  = 0;
+  }
+}; // end of class Persistent_list_
+
+#endif // PERSISTENT_LIST_HPP
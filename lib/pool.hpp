@@ -0,0 +1,167 @@
+/**
+* @file pool.hpp
+* @brief fixed-size node pool and monotonic arena for `List_`, both are `std::pmr` resources
+*/
+
+#ifndef POOL_HPP
+#define POOL_HPP
+
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <new>
+
+
+/**
+* @brief hands out fixed-size slots carved from big blocks, freed slots go to a free-list
+*   so an allocation is a free-list pop or a pointer bump
+*
+* the slot size is fixed by the first allocation ( the node size of the list using it ),
+* other sizes are forwarded to the upstream resource, not thread safe
+*/
+class Node_pool : public std::pmr::memory_resource
+{
+  struct Slot {
+    Slot *m_next = {nullptr};
+  }; // end of struct Slot
+
+  struct Block {
+    Block       *m_next   = {nullptr};
+    std::size_t  m_bytes  = {};
+  }; // end of struct Block
+
+  std::pmr::memory_resource *m_upstream     = {nullptr};
+  std::size_t                m_slot_size    = {};
+  std::size_t                m_slot_align   = {};
+  std::size_t                m_block_slots  = {};
+  Slot                      *m_free         = {nullptr};
+  Block                     *m_blocks       = {nullptr};
+  std::byte                 *m_cursor       = {nullptr};
+  std::byte                 *m_end          = {nullptr};
+
+public:
+
+  /* constructors */
+  explicit Node_pool(const std::size_t block_slots = 1024,
+                     std::pmr::memory_resource *upstream = std::pmr::get_default_resource()) noexcept
+    : m_upstream(upstream), m_block_slots(block_slots == 0 ? 1 : block_slots) {}
+  //
+  Node_pool(const Node_pool&)             = delete;
+  Node_pool& operator=(const Node_pool&)  = delete;
+  //
+  ~Node_pool() override { release(); }
+
+  /**
+  * @brief returns every block to upstream, all slots handed out become invalid
+  * @complexity O(blocks)
+  */
+  auto release()
+      noexcept -> void
+  {
+    while ( m_blocks != nullptr ) {
+      Block *next = m_blocks->m_next;
+      m_upstream->deallocate(m_blocks, m_blocks->m_bytes, alignof(std::max_align_t));
+      m_blocks = next;
+    }
+    m_free    = nullptr;
+    m_cursor  = nullptr;
+    m_end     = nullptr;
+  }
+
+  /**
+  * @brief carves the next `slots` slots for nodes of `bytes` / `align` out of one block, so a
+  *   bulk load lays its nodes out back to back, slots freed earlier are still handed out first
+  * @complexity O(1)
+  */
+  auto reserve(const std::size_t slots, const std::size_t bytes, const std::size_t align)
+      -> void
+  {
+    if ( m_slot_size == 0 ) { size_slots(bytes, align); }
+    if ( slots == 0 || !fits(bytes, align) ) { return; }
+    if ( static_cast<std::size_t>(m_end - m_cursor) / m_slot_size < slots ) { grow(slots); }
+  }
+
+  /**
+  * @brief size of one slot, zero until the first allocation
+  * @complexity O(1)
+  */
+  [[nodiscard]] auto slot_size()
+      const noexcept -> std::size_t
+  {
+    return m_slot_size;
+  }
+
+private:
+
+  [[nodiscard]] auto fits(const std::size_t bytes, const std::size_t align)
+      const noexcept -> bool
+  {
+    return bytes <= m_slot_size && align <= m_slot_align;
+  }
+
+  /// @brief fixes the slot size on the first allocation
+  auto size_slots(const std::size_t bytes, const std::size_t align)
+      noexcept -> void
+  {
+    m_slot_align  = align < alignof(Slot) ? alignof(Slot) : align;
+    m_slot_size   = bytes < sizeof(Slot) ? sizeof(Slot) : bytes;
+    m_slot_size   = (m_slot_size + m_slot_align - 1) / m_slot_align * m_slot_align;
+  }
+
+  /**
+  * @brief grabs a new block from upstream, blocks grow up to 64x the first one unless `slots` asks for more
+  * @throws std::bad_alloc when the block size does not fit a `std::size_t`
+  */
+  auto grow(const std::size_t slots = 0)
+      -> void
+  {
+    const std::size_t count   = slots > m_block_slots ? slots : m_block_slots;
+    const std::size_t header  = (sizeof(Block) + m_slot_align - 1) / m_slot_align * m_slot_align;
+    if ( count > (std::numeric_limits<std::size_t>::max() - header) / m_slot_size ) { throw std::bad_alloc(); }
+    const std::size_t bytes   = header + m_slot_size * count;
+    auto *block   = static_cast<Block *>(m_upstream->allocate(bytes, alignof(std::max_align_t)));
+    block->m_next   = m_blocks;
+    block->m_bytes  = bytes;
+    m_blocks  = block;
+    m_cursor  = reinterpret_cast<std::byte *>(block) + header;
+    m_end     = m_cursor + m_slot_size * count;
+    if ( m_block_slots < 64 * 1024 ) { m_block_slots *= 2; }
+  }
+
+  auto do_allocate(const std::size_t bytes, const std::size_t align)
+      -> void * override
+  {
+    if ( m_slot_size == 0 ) { size_slots(bytes, align); }
+    if ( !fits(bytes, align) ) { return m_upstream->allocate(bytes, align); }
+    if ( m_free != nullptr ) { // pop
+      Slot *slot  = m_free;
+      m_free      = slot->m_next;
+      return slot;
+    }
+    if ( m_cursor == m_end ) { grow(); }
+    void *slot  = m_cursor; // bump
+    m_cursor   += m_slot_size;
+    return slot;
+  }
+
+  auto do_deallocate(void *ptr, const std::size_t bytes, const std::size_t align)
+      -> void override
+  {
+    if ( !fits(bytes, align) ) { m_upstream->deallocate(ptr, bytes, align); return; }
+    m_free = ::new (ptr) Slot{m_free}; // push
+  }
+
+  [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other)
+      const noexcept -> bool override
+  {
+    return this == &other;
+  }
+}; // end of class Node_pool
+
+/**
+* @brief bump allocator, frees nothing until it is destroyed or `release()`d,
+*   ideal for lists that are built once and dropped as a whole
+*/
+using Arena = std::pmr::monotonic_buffer_resource;
+
+#endif // POOL_HPP
@@ -0,0 +1,144 @@
+/**
+* @file serial.hpp
+* @brief the binary format `List_::save` writes and `List_::load` reads: a 24 byte header then
+*   the elements, trivially copyable elements as one block of raw bytes, strings as a 64 bit
+*   length followed by their characters, host byte order, a reader refuses any other byte order
+*/
+
+#ifndef SERIAL_HPP
+#define SERIAL_HPP
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+
+namespace serial {
+
+/// @brief how the elements follow the header
+enum class Layout : std::uint8_t {
+  block   = 1, // `count * value_size` raw bytes
+  strings = 2, // per element a `std::uint64_t` length then `length * value_size` bytes
+};
+
+template <typename T> constexpr bool is_string = false;
+template <typename C, typename Traits, typename A>
+constexpr bool is_string<std::basic_string<C, Traits, A>> = std::is_trivially_copyable_v<C>;
+
+/// @brief element types a list can be saved with
+template <typename T>
+concept serializable = std::is_trivially_copyable_v<T> || is_string<T>;
+
+struct Header {
+  char          m_magic[4]     = {'D', 'L', 'S', 'T'};
+  std::uint16_t m_version      = 1;
+  std::uint8_t  m_layout       = {};
+  std::uint8_t  m_little       = {std::endian::native == std::endian::little};
+  std::uint32_t m_value_size   = {}; // sizeof the element, or of the character for strings
+  std::uint32_t m_reserved     = {};
+  std::uint64_t m_count        = {};
+}; // end of struct Header
+static_assert(sizeof(Header) == 24 && std::is_trivially_copyable_v<Header>);
+
+/// @brief the header a list of `count` `T`s gets
+template <serializable T>
+constexpr auto header_for(const std::uint64_t count)
+    noexcept -> Header
+{
+  Header header;
+  if constexpr ( std::is_trivially_copyable_v<T> ) {
+    header.m_layout     = static_cast<std::uint8_t>(Layout::block);
+    header.m_value_size = sizeof(T);
+  } else {
+    header.m_layout     = static_cast<std::uint8_t>(Layout::strings);
+    header.m_value_size = sizeof(typename T::value_type);
+  }
+  header.m_count = count;
+  return header;
+}
+
+/// @brief true when `header` came from `header_for<T>` on this kind of machine
+template <serializable T>
+constexpr auto matches(const Header& header)
+    noexcept -> bool
+{
+  const Header expected = header_for<T>(header.m_count);
+  return std::memcmp(header.m_magic, expected.m_magic, sizeof header.m_magic) == 0
+      && header.m_version    == expected.m_version
+      && header.m_layout     == expected.m_layout
+      && header.m_little     == expected.m_little
+      && header.m_value_size == expected.m_value_size;
+}
+
+/// @brief bytes staged before one write or read
+inline constexpr std::size_t buffer_bytes = 64 * 1024;
+
+/*
+* byte sinks and sources, `operator()` moves `n` bytes and says whether all of them made it
+*/
+struct Ostream_sink {
+  std::ostream& m_out;
+  auto operator()(const void *data, const std::size_t n) -> bool {
+    return static_cast<bool>(m_out.write(static_cast<const char *>(data), static_cast<std::streamsize>(n)));
+  }
+}; // end of struct Ostream_sink
+
+struct Istream_source {
+  std::istream& m_in;
+  auto operator()(void *data, const std::size_t n) -> bool {
+    return static_cast<bool>(m_in.read(static_cast<char *>(data), static_cast<std::streamsize>(n)));
+  }
+}; // end of struct Istream_source
+
+struct File_sink {
+  std::FILE *m_file;
+  auto operator()(const void *data, const std::size_t n) -> bool { return std::fwrite(data, 1, n, m_file) == n; }
+}; // end of struct File_sink
+
+struct File_source {
+  std::FILE *m_file;
+  auto operator()(void *data, const std::size_t n) -> bool { return std::fread(data, 1, n, m_file) == n; }
+}; // end of struct File_source
+
+/// @brief gathers small pieces into `buffer_bytes` writes, large pieces go straight through
+template <typename Sink>
+class Writer
+{
+  Sink                          m_sink;
+  std::unique_ptr<std::byte[]>  m_buffer = std::make_unique_for_overwrite<std::byte[]>(buffer_bytes);
+  std::size_t                   m_used   = {};
+  bool                          m_ok     = {true};
+
+public:
+  explicit Writer(Sink sink) : m_sink(sink) {}
+
+  auto put(const void *data, const std::size_t n)
+      -> void
+  {
+    if ( m_used + n > buffer_bytes ) { flush(); }
+    if ( n > buffer_bytes ) { m_ok = m_ok && m_sink(data, n); return; }
+    std::memcpy(m_buffer.get() + m_used, data, n);
+    m_used += n;
+  }
+
+  /// @brief false once any write failed
+  auto flush()
+      -> bool
+  {
+    if ( m_used != 0 ) { m_ok = m_ok && m_sink(m_buffer.get(), m_used); }
+    m_used = 0;
+    return m_ok;
+  }
+}; // end of class Writer
+
+} // namespace serial
+
+#endif // SERIAL_HPP
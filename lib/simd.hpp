@@ -0,0 +1,308 @@
+/**
+* @file simd.hpp
+* @brief vectorized find/count/min/max/sum over contiguous arrays of arithmetic elements,
+*   picks AVX2, SSE2 or a scalar loop at runtime, any other `T` goes to the `<algorithm>` version,
+*   `simd::limit` forces a lower level to test or time the others
+*/
+
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if ( defined(__x86_64__) || defined(__i386__) ) && ( defined(__GNUC__) || defined(__clang__) )
+  #define LIST_SIMD_X86 1
+  #include <immintrin.h>
+#else
+  #define LIST_SIMD_X86 0
+#endif
+
+
+namespace simd {
+
+/// @brief element types the kernels handle: 1/2/4/8 byte integers, float and double
+template <class T>
+concept vectorizable = ( std::integral<T> && !std::same_as<T, bool>
+                         && ( sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 ) )
+                       || std::same_as<T, float> || std::same_as<T, double>;
+
+enum class Level {scalar, sse2, avx2};
+
+namespace detail {
+
+  inline auto detect_level()
+      noexcept -> Level
+  {
+#if LIST_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt") ) { return Level::avx2; }
+    if ( __builtin_cpu_supports("sse2") )                                     { return Level::sse2; }
+#endif
+    return Level::scalar;
+  }
+
+  /**
+  * @brief folds [first, last) with `Lanes` independent accumulators seeded by the first
+  *   `Lanes` elements, the lanes map onto one vector register so the compiler emits packed
+  *   min/max/add for whatever target inlines it
+  */
+  template <std::size_t Lanes, class T, class Op>
+  [[gnu::always_inline]] inline
+  auto fold(const T *first, const T *last, const T init, Op op)
+      noexcept -> T
+  {
+    T acc = init;
+    if ( static_cast<std::size_t>(last - first) >= Lanes ) {
+      T lanes[Lanes];
+      std::copy_n(first, Lanes, lanes);
+      for (first += Lanes; static_cast<std::size_t>(last - first) >= Lanes; first += Lanes) {
+        for (std::size_t j = 0; j < Lanes; ++j) { lanes[j] = op(lanes[j], first[j]); }
+      }
+      for (std::size_t j = 0; j < Lanes; ++j) { acc = op(acc, lanes[j]); }
+    }
+    for (; first != last; ++first) { acc = op(acc, *first); }
+    return acc;
+  }
+
+  // a NaN on either side wins, so min/max come out the same whatever order the lanes fold in
+  template <class T> constexpr auto min_op = [](const T a, const T b) noexcept { return b < a || b != b ? b : a; };
+  template <class T> constexpr auto max_op = [](const T a, const T b) noexcept { return a < b || b != b ? b : a; };
+  template <class T> constexpr auto add_op = [](const T a, const T b) noexcept {
+    if constexpr ( std::integral<T> ) { // wrap instead of overflowing
+      using U = std::make_unsigned_t<T>;
+      return static_cast<T>(static_cast<U>(static_cast<U>(a) + static_cast<U>(b)));
+    } else {
+      return static_cast<T>(a + b);
+    }
+  };
+
+#if LIST_SIMD_X86
+
+  /// @brief one bit per byte of the 16 bytes at `p` that belong to an element equal to `v`
+  template <class T>
+  inline
+  auto eq_mask_sse2(const T *p, const T v)
+      noexcept -> std::uint32_t
+  {
+    if constexpr ( std::same_as<T, float> ) {
+      return _mm_movemask_epi8(_mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(p), _mm_set1_ps(v))));
+    } else if constexpr ( std::same_as<T, double> ) {
+      return _mm_movemask_epi8(_mm_castpd_si128(_mm_cmpeq_pd(_mm_loadu_pd(p), _mm_set1_pd(v))));
+    } else {
+      const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+      if constexpr ( sizeof(T) == 1 ) { return _mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi8(static_cast<char>(v)))); }
+      if constexpr ( sizeof(T) == 2 ) { return _mm_movemask_epi8(_mm_cmpeq_epi16(x, _mm_set1_epi16(static_cast<short>(v)))); }
+      if constexpr ( sizeof(T) == 4 ) { return _mm_movemask_epi8(_mm_cmpeq_epi32(x, _mm_set1_epi32(static_cast<int>(v)))); }
+      if constexpr ( sizeof(T) == 8 ) { // no 64-bit compare before SSE4.1: both 32-bit halves must match
+        const __m128i eq = _mm_cmpeq_epi32(x, _mm_set1_epi64x(static_cast<long long>(v)));
+        return _mm_movemask_epi8(_mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1))));
+      }
+    }
+  }
+
+  /// @brief one bit per byte of the 32 bytes at `p` that belong to an element equal to `v`
+  template <class T>
+  [[gnu::target("avx2")]] inline
+  auto eq_mask_avx2(const T *p, const T v)
+      noexcept -> std::uint32_t
+  {
+    if constexpr ( std::same_as<T, float> ) {
+      return _mm256_movemask_epi8(_mm256_castps_si256(_mm256_cmp_ps(_mm256_loadu_ps(p), _mm256_set1_ps(v), _CMP_EQ_OQ)));
+    } else if constexpr ( std::same_as<T, double> ) {
+      return _mm256_movemask_epi8(_mm256_castpd_si256(_mm256_cmp_pd(_mm256_loadu_pd(p), _mm256_set1_pd(v), _CMP_EQ_OQ)));
+    } else {
+      const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+      if constexpr ( sizeof(T) == 1 ) { return _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, _mm256_set1_epi8(static_cast<char>(v)))); }
+      if constexpr ( sizeof(T) == 2 ) { return _mm256_movemask_epi8(_mm256_cmpeq_epi16(x, _mm256_set1_epi16(static_cast<short>(v)))); }
+      if constexpr ( sizeof(T) == 4 ) { return _mm256_movemask_epi8(_mm256_cmpeq_epi32(x, _mm256_set1_epi32(static_cast<int>(v)))); }
+      if constexpr ( sizeof(T) == 8 ) { return _mm256_movemask_epi8(_mm256_cmpeq_epi64(x, _mm256_set1_epi64x(static_cast<long long>(v)))); }
+    }
+  }
+
+  template <class T>
+  auto find_sse2(const T *first, const T *last, const T v)
+      noexcept -> const T *
+  {
+    constexpr std::size_t W = 16 / sizeof(T);
+    for (; static_cast<std::size_t>(last - first) >= W; first += W) {
+      if ( const std::uint32_t m = eq_mask_sse2(first, v); m != 0 ) { return first + std::countr_zero(m) / sizeof(T); }
+    }
+    return std::find(first, last, v);
+  }
+
+  template <class T>
+  [[gnu::target("avx2")]]
+  auto find_avx2(const T *first, const T *last, const T v)
+      noexcept -> const T *
+  {
+    constexpr std::size_t W = 32 / sizeof(T);
+    for (; static_cast<std::size_t>(last - first) >= 2 * W; first += 2 * W) { // two loads per branch
+      const std::uint64_t m = eq_mask_avx2(first, v)
+                            | std::uint64_t{eq_mask_avx2(first + W, v)} << 32;
+      if ( m != 0 ) { return first + std::countr_zero(m) / sizeof(T); }
+    }
+    for (; static_cast<std::size_t>(last - first) >= W; first += W) {
+      if ( const std::uint32_t m = eq_mask_avx2(first, v); m != 0 ) { return first + std::countr_zero(m) / sizeof(T); }
+    }
+    return std::find(first, last, v);
+  }
+
+  template <class T>
+  auto count_sse2(const T *first, const T *last, const T v)
+      noexcept -> std::size_t
+  {
+    constexpr std::size_t W = 16 / sizeof(T);
+    std::size_t bits = 0;
+    for (; static_cast<std::size_t>(last - first) >= W; first += W) { bits += std::popcount(eq_mask_sse2(first, v)); }
+    return bits / sizeof(T) + static_cast<std::size_t>(std::count(first, last, v));
+  }
+
+  template <class T>
+  [[gnu::target("avx2,popcnt")]]
+  auto count_avx2(const T *first, const T *last, const T v)
+      noexcept -> std::size_t
+  {
+    constexpr std::size_t W = 32 / sizeof(T);
+    std::size_t bits = 0;
+    for (; static_cast<std::size_t>(last - first) >= W; first += W) {
+      bits += static_cast<std::size_t>(__builtin_popcount(eq_mask_avx2(first, v)));
+    }
+    return bits / sizeof(T) + static_cast<std::size_t>(std::count(first, last, v));
+  }
+
+  template <class T, class Op>
+  auto fold_sse2(const T *first, const T *last, const T init, Op op)
+      noexcept -> T
+  {
+    return fold<16 / sizeof(T)>(first, last, init, op);
+  }
+
+  template <class T, class Op>
+  [[gnu::target("avx2")]]
+  auto fold_avx2(const T *first, const T *last, const T init, Op op)
+      noexcept -> T
+  {
+    return fold<32 / sizeof(T)>(first, last, init, op);
+  }
+
+#endif // LIST_SIMD_X86
+
+} // namespace detail
+
+/// @brief the instruction set the kernels run on, probed once per process, lowered by `limit`
+inline std::atomic<Level> level = detail::detect_level();
+
+/**
+* @brief makes the kernels run on `max`, or on the best level below it the CPU supports,
+*   calls already running finish on the level they started with
+* @return the level in force before
+*/
+inline auto limit(const Level max)
+    noexcept -> Level
+{
+  return level.exchange(std::min(max, detail::detect_level()), std::memory_order_relaxed);
+}
+
+/**
+* @brief first element in [first, last) equal to `value`, `last` if none
+* @complexity O(n), 16 or 32 bytes compared per step for `vectorizable` T
+*/
+template <class T>
+constexpr
+auto find(const T *first, const T *last, const T &value)
+    -> const T *
+{
+#if LIST_SIMD_X86
+  if constexpr ( vectorizable<T> ) {
+    if ( !std::is_constant_evaluated() ) {
+      const Level now = level.load(std::memory_order_relaxed);
+      if ( now == Level::avx2 ) { return detail::find_avx2(first, last, value); }
+      if ( now == Level::sse2 ) { return detail::find_sse2(first, last, value); }
+    }
+  }
+#endif
+  return std::find(first, last, value);
+}
+
+/**
+* @brief number of elements in [first, last) equal to `value`
+* @complexity O(n)
+*/
+template <class T>
+constexpr
+auto count(const T *first, const T *last, const T &value)
+    -> std::size_t
+{
+#if LIST_SIMD_X86
+  if constexpr ( vectorizable<T> ) {
+    if ( !std::is_constant_evaluated() ) {
+      const Level now = level.load(std::memory_order_relaxed);
+      if ( now == Level::avx2 ) { return detail::count_avx2(first, last, value); }
+      if ( now == Level::sse2 ) { return detail::count_sse2(first, last, value); }
+    }
+  }
+#endif
+  return static_cast<std::size_t>(std::count(first, last, value));
+}
+
+/**
+* @brief folds [first, last) into `init` with `op` ( `min_op`, `max_op` or `add_op` ),
+*   vectorized folds combine partial results in a different order than a left fold,
+*   so a float sum may differ in the last bits; any NaN makes `min_op` and `max_op` NaN
+* @complexity O(n)
+*/
+template <class T, class Op>
+constexpr
+auto fold(const T *first, const T *last, const T &init, Op op)
+    -> T
+{
+#if LIST_SIMD_X86
+  if constexpr ( vectorizable<T> ) {
+    if ( !std::is_constant_evaluated() ) {
+      const Level now = level.load(std::memory_order_relaxed);
+      if ( now == Level::avx2 ) { return detail::fold_avx2(first, last, init, op); }
+      if ( now == Level::sse2 ) { return detail::fold_sse2(first, last, init, op); }
+    }
+  }
+#endif
+  T acc = init;
+  for (; first != last; ++first) { acc = op(acc, *first); }
+  return acc;
+}
+
+/// @brief smallest of `init` and [first, last)
+template <class T>
+constexpr
+auto min(const T *first, const T *last, const T &init)
+    -> T
+{
+  return simd::fold(first, last, init, detail::min_op<T>);
+}
+
+/// @brief largest of `init` and [first, last)
+template <class T>
+constexpr
+auto max(const T *first, const T *last, const T &init)
+    -> T
+{
+  return simd::fold(first, last, init, detail::max_op<T>);
+}
+
+/// @brief `init` plus every element of [first, last), integers wrap like `T` arithmetic
+template <class T>
+constexpr
+auto sum(const T *first, const T *last, const T &init)
+    -> T
+{
+  return simd::fold(first, last, init, detail::add_op<T>);
+}
+
+} // namespace simd
+
+#endif // SIMD_HPP
@@ -0,0 +1,64 @@
+/**
+* @file static_list.hpp
+* @brief `StaticList_`, a doubly linked list of at most `N` elements stored inside the object,
+*   no heap traffic at all, links are 16 bit slot indices up to 65534 slots and 32 bit above
+*/
+
+#ifndef STATIC_LIST_HPP
+#define STATIC_LIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "apology.hpp"
+#include "index_linked.hpp"
+
+
+namespace detail {
+
+  /// @brief `N` slots inside the object, never grows, left uninitialized: only [0, m_used) is ever read
+  template <typename T, typename Index, std::size_t N>
+  class Inline_slots
+  {
+    Index_slot<T, Index> m_slots[N];
+
+  public:
+    static constexpr bool growable = false;
+    //
+    constexpr Inline_slots() noexcept = default;
+    /// @brief slots never travel with a copy, the list refills them
+    constexpr Inline_slots(const Inline_slots&) noexcept {}
+    Inline_slots& operator=(const Inline_slots&) = delete;
+    //
+    constexpr auto slots()       noexcept -> Index_slot<T, Index> *       { return m_slots; }
+    constexpr auto slots() const noexcept -> const Index_slot<T, Index> * { return m_slots; }
+    //
+    static constexpr auto capacity() noexcept -> std::size_t { return N; }
+  }; // end of class Inline_slots
+
+} // namespace detail
+
+/**
+* @brief same push/pop/at/search/sort api as `List_` over a fixed array of slots, pushing into
+*   a full list reports `Apology::full` through `Policy`, `try_emplace_back` / `try_emplace_front`
+*   return false instead
+*
+* @tparam T element type
+* @tparam N capacity
+* @tparam Policy what happens on misuse, see `policy`
+*/
+template <typename T, std::size_t N, error_policy Policy = policy::Apologize>
+class StaticList_
+  : public detail::Index_linked_<T, detail::index_for<N>, detail::Inline_slots<T, detail::index_for<N>, N>, Policy>
+{
+  static_assert(N > 0 && N < UINT32_MAX, "a StaticList_ holds between 1 and 2^32-2 elements");
+
+  using base = detail::Index_linked_<T, detail::index_for<N>, detail::Inline_slots<T, detail::index_for<N>, N>, Policy>;
+
+public:
+
+  using index_type = detail::index_for<N>;
+
+  using base::base;
+}; // end of class StaticList_
+
+#endif // STATIC_LIST_HPP
@@ -0,0 +1,159 @@
+/**
+* @file stats.hpp
+* @brief optional instrumentation for `List_`: node allocations and frees, bytes in use,
+*   nodes stepped through while looking for a position or a value, and calls per operation,
+*   per list and summed over the process, picked at compile time by the `Stats` template parameter
+*/
+
+#ifndef STATS_HPP
+#define STATS_HPP
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+
+namespace stats {
+
+/// @brief operations counted by `Counters::m_calls`, one forwarding to another counts for both
+enum class Op : std::uint8_t {
+  at, push_back, push_front, push_at, pop_back, pop_front, pop_at,
+  insert, erase, search, locate, sort, splice,
+};
+
+inline constexpr std::size_t op_count = static_cast<std::size_t>(Op::splice) + 1;
+
+constexpr
+auto name(const Op op)
+    noexcept -> std::string_view
+{
+  constexpr std::array<std::string_view, op_count> names = {
+    "at", "push_back", "push_front", "push_at", "pop_back", "pop_front", "pop_at",
+    "insert", "erase", "search", "locate", "sort", "splice",
+  };
+  return names[static_cast<std::size_t>(op)];
+}
+
+/// @brief what one list, or the whole process, did so far
+struct Counters {
+  std::uint64_t                         m_allocations   = {};
+  std::uint64_t                         m_frees         = {};
+  std::uint64_t                         m_bytes_in_use  = {};
+  std::uint64_t                         m_nodes_walked  = {}; // steps taken to reach a position or a value
+  std::array<std::uint64_t, op_count>   m_calls         = {};
+  //
+  [[nodiscard]] constexpr auto calls(const Op op) const noexcept -> std::uint64_t {
+    return m_calls[static_cast<std::size_t>(op)];
+  }
+}; // end of struct Counters
+
+namespace detail {
+  /// @brief process wide sums, relaxed: they are statistics, not synchronization
+  struct Totals {
+    std::atomic<std::uint64_t>                        m_allocations   = {0};
+    std::atomic<std::uint64_t>                        m_frees         = {0};
+    std::atomic<std::uint64_t>                        m_bytes_in_use  = {0};
+    std::atomic<std::uint64_t>                        m_nodes_walked  = {0};
+    std::array<std::atomic<std::uint64_t>, op_count>  m_calls         = {};
+  }; // end of struct Totals
+
+  inline Totals totals;
+} // namespace detail
+
+/**
+* @brief sums over every list using `stats::Count` in the process
+*/
+inline auto process()
+    noexcept -> Counters
+{
+  constexpr auto relaxed = std::memory_order_relaxed;
+  Counters sum;
+  sum.m_allocations   = detail::totals.m_allocations.load(relaxed);
+  sum.m_frees         = detail::totals.m_frees.load(relaxed);
+  sum.m_bytes_in_use  = detail::totals.m_bytes_in_use.load(relaxed);
+  sum.m_nodes_walked  = detail::totals.m_nodes_walked.load(relaxed);
+  for (std::size_t i = 0; i < op_count; ++i) { sum.m_calls[i] = detail::totals.m_calls[i].load(relaxed); }
+  return sum;
+}
+
+/// @brief counts nothing, takes no space, every hook compiles away
+struct None {
+  static constexpr bool enabled = false;
+  //
+  constexpr auto allocated(std::size_t)   noexcept -> void {}
+  constexpr auto freed(std::size_t)       noexcept -> void {}
+  constexpr auto walked(std::size_t)      noexcept -> void {}
+  constexpr auto called(Op)               noexcept -> void {}
+}; // end of struct None
+
+/**
+* @brief counts into the list's own `Counters` and into the process totals, bytes in use are
+*   only summed for the process, a list works its own out from its size since splicing moves nodes,
+*   nothing is counted during constant evaluation; const lookups are counted too, so unlike with
+*   `None` one counted list must not be read from several threads at once
+*/
+class Count
+{
+  Counters m_counters;
+
+public:
+
+  static constexpr bool enabled = true;
+
+  constexpr auto allocated(const std::size_t bytes)
+      noexcept -> void
+  {
+    if ( std::is_constant_evaluated() ) { return; }
+    ++m_counters.m_allocations;
+    detail::totals.m_allocations.fetch_add(1, std::memory_order_relaxed);
+    detail::totals.m_bytes_in_use.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  constexpr auto freed(const std::size_t bytes)
+      noexcept -> void
+  {
+    if ( std::is_constant_evaluated() ) { return; }
+    ++m_counters.m_frees;
+    detail::totals.m_frees.fetch_add(1, std::memory_order_relaxed);
+    detail::totals.m_bytes_in_use.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+
+  constexpr auto walked(const std::size_t nodes)
+      noexcept -> void
+  {
+    if ( std::is_constant_evaluated() ) { return; }
+    m_counters.m_nodes_walked += nodes;
+    detail::totals.m_nodes_walked.fetch_add(nodes, std::memory_order_relaxed);
+  }
+
+  constexpr auto called(const Op op)
+      noexcept -> void
+  {
+    if ( std::is_constant_evaluated() ) { return; }
+    ++m_counters.m_calls[static_cast<std::size_t>(op)];
+    detail::totals.m_calls[static_cast<std::size_t>(op)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] constexpr auto counters()
+      const noexcept -> const Counters&
+  {
+    return m_counters;
+  }
+}; // end of class Count
+
+} // namespace stats
+
+template <typename S>
+concept stats_policy = std::default_initializable<S> && requires (S s, const std::size_t n, const stats::Op op) {
+  { S::enabled } -> std::convertible_to<bool>;
+  s.allocated(n);
+  s.freed(n);
+  s.walked(n);
+  s.called(op);
+};
+
+#endif // STATS_HPP
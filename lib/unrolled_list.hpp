@@ -0,0 +1,952 @@
+/**
+* @file unrolled_list.hpp
+* @brief a double linked list keeping up to `K` elements per node in a contiguous chunk,
+*   same push/pop/at/search api as `List_` but traversal walks arrays instead of nodes
+*/
+
+#ifndef UNROLLED_LIST_HPP
+#define UNROLLED_LIST_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include "apology.hpp"
+#include "simd.hpp"
+#ifdef LIST_IOSTREAM
+#include <iostream>
+#endif
+
+
+/// @brief default elements per chunk, about a page of payload but never less than 8
+template <typename T>
+inline constexpr std::size_t unrolled_chunk_size = std::max<std::size_t>(8, 4096 / sizeof(T));
+
+/**
+* @tparam T element type
+* @tparam K elements per chunk
+* @tparam Alloc allocator used for the chunks, rebound to the chunk type internally
+* @tparam Policy what happens on misuse, see `policy` and `List_`
+*/
+template <typename T, std::size_t K = unrolled_chunk_size<T>, typename Alloc = std::allocator<T>,
+          error_policy Policy = policy::Apologize>
+class Unrolled_list_ : protected detail::Failed_slot_for<T, Policy>
+{
+  static_assert(K > 1 && K <= UINT32_MAX, "a chunk holds between 2 and 2^32-1 elements");
+
+  /// @brief elements live in [m_begin, m_begin + m_count) of `m_slots`
+  class Chunk {
+  public:
+    Chunk        *m_next  = {nullptr};
+    Chunk        *m_prev  = {nullptr};
+    std::uint32_t m_begin = {};
+    std::uint32_t m_count = {};
+    union { T m_slots[K]; };
+    //
+    constexpr Chunk() noexcept {}
+    constexpr ~Chunk() {}
+    //
+    constexpr auto data()       noexcept -> T *       { return m_slots + m_begin; }
+    constexpr auto data() const noexcept -> const T * { return m_slots + m_begin; }
+    constexpr auto end_slot() const noexcept -> std::size_t { return m_begin + m_count; }
+  }; // end of class Chunk
+
+  using chunk_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Chunk>;
+  using chunk_traits    = std::allocator_traits<chunk_allocator>;
+
+  Chunk      *m_head = {nullptr};
+  Chunk      *m_tail = {nullptr};
+  std::size_t m_size = {};
+  [[no_unique_address]] chunk_allocator m_alloc = {};
+  // last chunk reached by index and the position of its first element, null when unknown,
+  // only non const lookups move it so const ones can run on several threads at once
+  Chunk      *m_cursor      = {nullptr};
+  std::size_t m_cursor_base = {};
+
+  using detail::Failed_slot_for<T, Policy>::failed;
+
+  /// @brief true when the operation must bail out, see `detail::fails`
+  [[nodiscard]] static constexpr auto fails(const bool bad, const Apology apology)
+      -> bool
+  {
+    return detail::fails<Policy>(bad, apology);
+  }
+
+  /// @brief allocates an empty chunk, `begin` is where its first element will go
+  constexpr
+  auto create_chunk(const std::uint32_t begin)
+      -> Chunk *
+  {
+    Chunk *chunk = chunk_traits::allocate(m_alloc, 1);
+    std::construct_at(chunk);
+    chunk->m_begin = begin;
+    return chunk;
+  }
+
+  /**
+  * @brief a detached chunk holding one element built from `args` in slot `at`, the element is
+  *   built before the chunk is linked so a throwing constructor never leaves an empty chunk
+  */
+  template <typename ...Args>
+  constexpr
+  auto create_filled_chunk(const std::uint32_t at, Args&& ...args)
+      -> Chunk *
+  {
+    Chunk *chunk = create_chunk(at);
+    try {
+      std::construct_at(chunk->m_slots + at, std::forward<Args>(args)...);
+    } catch (...) {
+      destroy_chunk(chunk);
+      throw;
+    }
+    chunk->m_count = 1;
+    return chunk;
+  }
+
+  /// @brief destroys the elements of `chunk` and gives its memory back
+  constexpr
+  auto destroy_chunk(Chunk *chunk)
+      noexcept -> void
+  {
+    std::destroy_n(chunk->data(), chunk->m_count);
+    std::destroy_at(chunk);
+    chunk_traits::deallocate(m_alloc, chunk, 1);
+  }
+
+  /// @brief links `chunk` after `prev`, a null `prev` makes it the head
+  constexpr
+  auto link_after(Chunk *prev, Chunk *chunk)
+      noexcept -> void
+  {
+    chunk->m_prev = prev;
+    chunk->m_next = ( prev != nullptr ) ? prev->m_next : m_head;
+    if ( chunk->m_next != nullptr ) { chunk->m_next->m_prev = chunk; }
+    else                            { m_tail = chunk; }
+    if ( prev != nullptr )          { prev->m_next = chunk; }
+    else                            { m_head = chunk; }
+  }
+
+  /// @brief unlinks `chunk` and destroys it
+  constexpr
+  auto unlink(Chunk *chunk)
+      noexcept -> void
+  {
+    if ( chunk == m_cursor )        { m_cursor = nullptr; }
+    if ( chunk->m_prev != nullptr ) { chunk->m_prev->m_next = chunk->m_next; }
+    else                            { m_head = chunk->m_next; }
+    if ( chunk->m_next != nullptr ) { chunk->m_next->m_prev = chunk->m_prev; }
+    else                            { m_tail = chunk->m_prev; }
+    destroy_chunk(chunk);
+  }
+
+  /// @brief moves slot `from` of `src` into the unconstructed slot `to` of `dst`
+  static
+  constexpr
+  auto relocate(Chunk *src, const std::size_t from, Chunk *dst, const std::size_t to)
+      -> void
+  {
+    std::construct_at(dst->m_slots + to, std::move(src->m_slots[from]));
+    std::destroy_at(src->m_slots + from);
+  }
+
+  /// @brief moves slot `from` into the unconstructed slot `to` of the same chunk
+  static
+  constexpr
+  auto relocate(Chunk *chunk, const std::size_t from, const std::size_t to)
+      -> void
+  {
+    relocate(chunk, from, chunk, to);
+  }
+
+  /**
+  * @brief opens an unconstructed slot for offset `off` of a chunk that is not full,
+  *   shifting whichever side is cheaper and possible
+  * @return the slot index to construct into
+  */
+  static
+  constexpr
+  auto open_slot(Chunk *chunk, const std::size_t off)
+      -> std::size_t
+  {
+    const bool room_back  = chunk->end_slot() < K;
+    const bool room_front = chunk->m_begin > 0;
+    if ( room_front && ( !room_back || off < chunk->m_count - off ) ) {
+      for (std::size_t i = chunk->m_begin; i < chunk->m_begin + off; ++i) { relocate(chunk, i, i - 1); }
+      --chunk->m_begin;
+      ++chunk->m_count;
+      return chunk->m_begin + off;
+    }
+    for (std::size_t i = chunk->end_slot(); i > chunk->m_begin + off; --i) { relocate(chunk, i - 1, i); }
+    ++chunk->m_count;
+    return chunk->m_begin + off;
+  }
+
+  /// @brief moves the upper half of a full `chunk` into a new chunk linked after it
+  constexpr
+  auto split(Chunk *chunk)
+      -> Chunk *
+  {
+    Chunk *upper          = create_chunk(0);
+    const std::size_t keep = chunk->m_count / 2;
+    for (std::size_t i = keep; i < chunk->m_count; ++i) {
+      relocate(chunk, chunk->m_begin + i, upper, upper->m_count++);
+    }
+    chunk->m_count = static_cast<std::uint32_t>(keep);
+    link_after(chunk, upper);
+    return upper;
+  }
+
+  /// @brief folds `chunk->m_next` into `chunk` once both are at most half full together
+  constexpr
+  auto try_merge(Chunk *chunk)
+      -> void
+  {
+    Chunk *next = chunk->m_next;
+    if ( next == nullptr || chunk->m_count + next->m_count > K / 2 ) { return; }
+    if ( chunk->end_slot() + next->m_count > K ) { // slide to the front first
+      for (std::size_t i = 0; i < chunk->m_count; ++i) { relocate(chunk, chunk->m_begin + i, i); }
+      chunk->m_begin = 0;
+    }
+    for (std::size_t i = 0; i < next->m_count; ++i) {
+      relocate(next, next->m_begin + i, chunk, chunk->end_slot());
+      ++chunk->m_count;
+    }
+    next->m_count = 0;
+    unlink(next);
+  }
+
+  /**
+  * @brief finds the chunk holding `pos` and the offset inside it, `pos` must be valid,
+  *   walks from the head, the tail or the cached cursor, whichever is closest, leaves the cursor alone
+  */
+  constexpr
+  auto locate_chunk(const std::size_t pos) const noexcept
+      -> std::pair<Chunk *, std::size_t>
+  {
+    Chunk      *it    = m_head;
+    std::size_t base  = 0;
+    std::size_t dist  = pos;
+    if ( m_size - pos < dist ) {
+      it    = m_tail;
+      base  = m_size - m_tail->m_count;
+      dist  = m_size - pos;
+    }
+    if ( m_cursor != nullptr ) {
+      const std::size_t to_cursor = pos > m_cursor_base ? pos - m_cursor_base : m_cursor_base - pos;
+      if ( to_cursor < dist ) {
+        it    = m_cursor;
+        base  = m_cursor_base;
+      }
+    }
+    while ( pos < base )                { it = it->m_prev; base -= it->m_count; }
+    while ( pos >= base + it->m_count ) { base += it->m_count; it = it->m_next; }
+    return {it, pos - base};
+  }
+
+  /// @brief `locate_chunk` that also moves the cursor onto the chunk found
+  constexpr
+  auto seek(const std::size_t pos) noexcept
+      -> std::pair<Chunk *, std::size_t>
+  {
+    const auto found  = locate_chunk(pos);
+    m_cursor          = found.first;
+    m_cursor_base     = pos - found.second;
+    return found;
+  }
+
+  /// @brief threads `acc` through `kernel(first, last, acc)` for every chunk
+  template <class Kernel>
+  constexpr
+  auto fold_chunks(T acc, Kernel kernel) const
+      -> T
+  {
+    for (const Chunk *it = m_head; it != nullptr; it = it->m_next) {
+      acc = kernel(it->data(), it->data() + it->m_count, acc);
+    }
+    return acc;
+  }
+
+  /// @brief constructs an element at offset `off` of `chunk`, splitting it when full
+  template <typename ...Args>
+  constexpr
+  auto emplace_into(Chunk *chunk, std::size_t off, Args&& ...args)
+      -> T &
+  {
+    if ( chunk != m_cursor ) { m_cursor = nullptr; } // chunks after this one shift
+    if ( chunk->m_count == K ) {
+      Chunk *upper = split(chunk);
+      if ( off > chunk->m_count ) { off -= chunk->m_count; chunk = upper; }
+    }
+    const std::size_t slot = open_slot(chunk, off);
+    try {
+      std::construct_at(chunk->m_slots + slot, std::forward<Args>(args)...);
+    } catch (...) { // close the slot again
+      for (std::size_t i = slot + 1; i < chunk->end_slot(); ++i) { relocate(chunk, i, i - 1); }
+      --chunk->m_count;
+      throw;
+    }
+    ++m_size;
+    return chunk->m_slots[slot];
+  }
+
+  /// @brief destroys the element at offset `off` of `chunk`
+  constexpr
+  auto erase_from(Chunk *chunk, const std::size_t off)
+      -> void
+  {
+    if ( chunk != m_cursor ) { m_cursor = nullptr; } // chunks after this one shift
+    std::destroy_at(chunk->data() + off);
+    if ( off < chunk->m_count / 2 ) { // close the gap from the cheaper side
+      for (std::size_t i = chunk->m_begin + off; i > chunk->m_begin; --i) { relocate(chunk, i - 1, i); }
+      ++chunk->m_begin;
+    } else {
+      for (std::size_t i = chunk->m_begin + off + 1; i < chunk->end_slot(); ++i) { relocate(chunk, i, i - 1); }
+    }
+    --chunk->m_count;
+    --m_size;
+    if ( chunk->m_count == 0 )  { unlink(chunk); return; }
+    try_merge(chunk);
+    if ( chunk->m_prev != nullptr ) { try_merge(chunk->m_prev); }
+  }
+
+  /// @brief destroys every chunk
+  constexpr
+  auto release()
+      noexcept -> void
+  {
+    while ( m_head != nullptr ) {
+      Chunk *next = m_head->m_next;
+      destroy_chunk(m_head);
+      m_head = next;
+    }
+    m_tail    = nullptr;
+    m_size    = 0;
+    m_cursor  = nullptr;
+  }
+
+  /// @brief takes the chunks of `rhs`, leaving it empty
+  constexpr
+  auto steal(Unrolled_list_& rhs)
+      noexcept -> void
+  {
+    m_head    = rhs.m_head;
+    m_tail    = rhs.m_tail;
+    m_size    = rhs.m_size;
+    m_cursor  = nullptr;
+    //
+    rhs.m_head    = nullptr;
+    rhs.m_tail    = nullptr;
+    rhs.m_size    = {};
+    rhs.m_cursor  = nullptr;
+  }
+
+  /**
+  * @brief bidirectional iterator over the elements, keeps the bounds of the current chunk
+  *   so stepping inside a chunk is a pointer increment, `end()` has no chunk but knows its list
+  * @tparam Const true for `const_iterator`
+  */
+  template <bool Const>
+  class basic_iterator {
+  private:
+    friend class Unrolled_list_;
+    template <bool> friend class basic_iterator;
+    //
+    Chunk                 *chunk_ptr  {nullptr};
+    T                     *elem_ptr   {nullptr};
+    T                     *last_ptr   {nullptr}; // one past the last element of `chunk_ptr`
+    const Unrolled_list_  *list_ptr   {nullptr};
+    //
+    constexpr basic_iterator(Chunk *chunk, const std::size_t off, const Unrolled_list_ *list) noexcept
+      : list_ptr(list) {
+      enter(chunk);
+      if ( chunk != nullptr ) { elem_ptr += off; }
+    }
+    //
+    constexpr auto enter(Chunk *chunk) noexcept -> void {
+      chunk_ptr = chunk;
+      elem_ptr  = ( chunk != nullptr ) ? chunk->data() : nullptr;
+      last_ptr  = ( chunk != nullptr ) ? chunk->data() + chunk->m_count : nullptr;
+    }
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, const T *, T *>;
+    using reference         = std::conditional_t<Const, const T &, T &>;
+    //
+    constexpr basic_iterator() noexcept = default;
+    // iterator -> const_iterator
+    constexpr basic_iterator(const basic_iterator<!Const>& other) noexcept requires Const
+      : chunk_ptr(other.chunk_ptr), elem_ptr(other.elem_ptr), last_ptr(other.last_ptr), list_ptr(other.list_ptr) {}
+    //
+    template <bool C>
+    constexpr bool operator==(const basic_iterator<C>& rhs) const noexcept {
+      return elem_ptr == rhs.elem_ptr;
+    }
+    //
+    constexpr reference operator*() const noexcept {
+      return *elem_ptr;
+    }
+    //
+    constexpr pointer operator->() const noexcept {
+      return elem_ptr;
+    }
+    // pre increment
+    constexpr basic_iterator& operator++() noexcept {
+      if ( ++elem_ptr == last_ptr ) { enter(chunk_ptr->m_next); }
+      return *this;
+    }
+    // pre decrement
+    constexpr basic_iterator& operator--() noexcept {
+      if ( chunk_ptr == nullptr || elem_ptr == chunk_ptr->data() ) {
+        enter( chunk_ptr == nullptr ? list_ptr->m_tail : chunk_ptr->m_prev );
+        elem_ptr = last_ptr;
+      }
+      --elem_ptr;
+      return *this;
+    }
+    // post increment
+    constexpr basic_iterator operator++(int) noexcept {
+      basic_iterator old = *this;
+      ++*this;
+      return old;
+    }
+    // post decrement
+    constexpr basic_iterator operator--(int) noexcept {
+      basic_iterator old = *this;
+      --*this;
+      return old;
+    }
+  }; // end of class basic_iterator
+
+public:
+
+  using value_type              = T;
+  using allocator_type          = Alloc;
+  using size_type               = std::size_t;
+  using difference_type         = std::ptrdiff_t;
+  using reference               = T &;
+  using const_reference         = const T &;
+  using iterator                = basic_iterator<false>;
+  using const_iterator          = basic_iterator<true>;
+  using reverse_iterator        = std::reverse_iterator<iterator>;
+  using const_reverse_iterator  = std::reverse_iterator<const_iterator>;
+
+  static constexpr std::size_t chunk_size = K;
+
+  [[nodiscard]] constexpr auto begin()  const noexcept -> const_iterator { return const_iterator(m_head, 0, this); }
+  [[nodiscard]] constexpr auto end()    const noexcept -> const_iterator { return const_iterator(nullptr, 0, this); }
+  [[nodiscard]] constexpr auto begin()  noexcept -> iterator { return iterator(m_head, 0, this); }
+  [[nodiscard]] constexpr auto end()    noexcept -> iterator { return iterator(nullptr, 0, this); }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] constexpr auto cend()   const noexcept -> const_iterator { return end(); }
+  //
+  [[nodiscard]] constexpr auto rbegin()   const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+  [[nodiscard]] constexpr auto rend()     const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+  [[nodiscard]] constexpr auto rbegin()   noexcept -> reverse_iterator { return reverse_iterator(end()); }
+  [[nodiscard]] constexpr auto rend()     noexcept -> reverse_iterator { return reverse_iterator(begin()); }
+  [[nodiscard]] constexpr auto crbegin()  const noexcept -> const_reverse_iterator { return rbegin(); }
+  [[nodiscard]] constexpr auto crend()    const noexcept -> const_reverse_iterator { return rend(); }
+
+  /* constructors */
+  constexpr Unrolled_list_() noexcept = default;
+  //
+  explicit constexpr Unrolled_list_(const Alloc& alloc) noexcept
+    : m_alloc(alloc) {}
+  //
+  constexpr Unrolled_list_(Unrolled_list_ && rhs) noexcept
+    : m_alloc(std::move(rhs.m_alloc)) {
+    steal(rhs);
+  }
+  //
+  constexpr Unrolled_list_(const Unrolled_list_& rhs)
+    : m_alloc(chunk_traits::select_on_container_copy_construction(rhs.m_alloc)) {
+    for (const auto& i : rhs) { push_back(i); }
+  }
+  //
+  constexpr Unrolled_list_(const std::initializer_list<T> &arg, const Alloc& alloc = Alloc())
+    : m_alloc(alloc) {
+    for (const auto &i : arg) { push_back(i); }
+  }
+  //
+  constexpr ~Unrolled_list_() { release(); }
+
+  //
+  constexpr Unrolled_list_& operator=(const Unrolled_list_& rhs) {
+    if (this != &rhs) {
+      release();
+      if constexpr ( chunk_traits::propagate_on_container_copy_assignment::value ) {
+        m_alloc = rhs.m_alloc;
+      }
+      for (const auto& i : rhs) { push_back(i); }
+    }
+    return *this;
+  }
+
+  //
+  constexpr Unrolled_list_& operator=(Unrolled_list_&& rhs)
+      noexcept(chunk_traits::propagate_on_container_move_assignment::value
+            || chunk_traits::is_always_equal::value) {
+    if (this != &rhs) {
+      release();
+      if constexpr ( chunk_traits::propagate_on_container_move_assignment::value ) {
+        m_alloc = std::move(rhs.m_alloc);
+        steal(rhs);
+      } else {
+        if ( m_alloc == rhs.m_alloc ) { steal(rhs); return *this; }
+        // chunks can't change hands between unequal allocators
+        for (auto& i : rhs) { push_back(std::move(i)); }
+        rhs.release();
+      }
+    }
+    return *this;
+  }
+
+  /*@ methods: */
+  /**
+  * @brief returns a copy of the allocator used for the chunks
+  * @complexity O(1)
+  */
+  [[nodiscard]] constexpr auto get_allocator()
+      const noexcept -> Alloc
+  {
+    return Alloc(m_alloc);
+  }
+
+  /**
+  * @brief check if list is empty
+  * @complexity O(1)
+  */
+  [[nodiscard]] constexpr auto is_empty()
+      const noexcept -> bool
+  {
+    return m_size == 0;
+  }
+
+  /**
+  * @brief returns size of the list
+  * @complexity O(1)
+  */
+  [[nodiscard]] constexpr auto size()
+      const noexcept -> std::size_t
+  {
+    return m_size;
+  }
+
+  /**
+  * @brief returns first element
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto front()
+      -> T &
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return failed(); }
+    return m_head->data()[0];
+  }
+
+  /**
+  * @brief return last element&
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto back()
+      -> T &
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return failed(); }
+    return m_tail->data()[m_tail->m_count - 1];
+  }
+
+  /**
+  * @brief prints the list in both `forward and backword`
+  * @param out
+  * @param order `true` for forward `false` for backword
+  * @param delimiter
+  */
+  auto print(std::ostream& out, const bool order = true, const char delimiter = ' ')
+      const -> void
+  {
+    if ( fails(is_empty(), Apology::empty) )   { return; }
+    if ( order ) {
+      for ( const auto& i : *this ) { out << i << ' '; }
+    } else {
+      for ( auto i = rbegin(); i != rend(); ++i ) { out << *i << ' '; }
+    }
+    out << delimiter;
+  }
+
+#ifdef LIST_IOSTREAM
+  /// @brief prints to `std::cout`, only when `LIST_IOSTREAM` is defined so `<iostream>` stays opt in
+  auto print(const bool order = true, const char delimiter = ' ')
+      const -> void
+  {
+    print(std::cout, order, delimiter);
+  }
+#endif
+
+  /**
+  * @brief return element at given position&, skips whole chunks from the head, the tail
+  *   or the chunk of the last indexed access, whichever is closer
+  * @complexity O(min(pos, size - pos, |pos - last pos|) / K)
+  */
+  [[nodiscard]]
+  constexpr
+  auto at(const std::size_t pos)
+      -> T &
+  {
+    if ( fails(is_empty(), Apology::empty) )     { return failed(); }
+    if ( fails(pos >= m_size, Apology::invalid_position) )  { return failed(); }
+    const auto [chunk, off] = seek(pos);
+    return chunk->data()[off];
+  }
+
+  /// @brief starts from the chunk of the last non const indexed access but never moves it, safe to call from several threads
+  [[nodiscard]]
+  constexpr
+  auto at(const std::size_t pos) const
+      -> T
+  {
+    if ( fails(is_empty(), Apology::empty) )     { return failed(); }
+    if ( fails(pos >= m_size, Apology::invalid_position) )  { return failed(); }
+    const auto [chunk, off] = locate_chunk(pos);
+    return chunk->data()[off];
+  }
+
+  /**
+  * @brief first element or null when empty, never apologizes
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto try_front()
+      noexcept -> T *
+  {
+    return is_empty() ? nullptr : m_head->data();
+  }
+
+  [[nodiscard]]
+  constexpr
+  auto try_front() const
+      noexcept -> const T *
+  {
+    return is_empty() ? nullptr : m_head->data();
+  }
+
+  /**
+  * @brief last element or null when empty, never apologizes
+  * @complexity O(1)
+  */
+  [[nodiscard]]
+  constexpr
+  auto try_back()
+      noexcept -> T *
+  {
+    return is_empty() ? nullptr : m_tail->data() + m_tail->m_count - 1;
+  }
+
+  [[nodiscard]]
+  constexpr
+  auto try_back() const
+      noexcept -> const T *
+  {
+    return is_empty() ? nullptr : m_tail->data() + m_tail->m_count - 1;
+  }
+
+  /**
+  * @brief element at `pos` or null when out of range, never apologizes
+  * @complexity same as `at()`
+  */
+  [[nodiscard]]
+  constexpr
+  auto try_at(const std::size_t pos)
+      noexcept -> T *
+  {
+    if ( pos >= m_size ) { return nullptr; }
+    const auto [chunk, off] = seek(pos);
+    return chunk->data() + off;
+  }
+
+  [[nodiscard]]
+  constexpr
+  auto try_at(const std::size_t pos) const
+      noexcept -> const T *
+  {
+    if ( pos >= m_size ) { return nullptr; }
+    const auto [chunk, off] = locate_chunk(pos);
+    return chunk->data() + off;
+  }
+
+  /**
+  * @brief constructs an element in place at the end of list
+  * @complexity O(1)
+  */
+  template <typename ...Args>
+  constexpr
+  auto emplace_back(Args&& ...args)
+      -> T &
+  {
+    if ( m_tail == nullptr || m_tail->end_slot() == K ) {
+      link_after(m_tail, create_filled_chunk(0, std::forward<Args>(args)...));
+    } else {
+      std::construct_at(m_tail->m_slots + m_tail->end_slot(), std::forward<Args>(args)...);
+      ++m_tail->m_count;
+    }
+    ++m_size;
+    return back();
+  }
+
+  /**
+  * @brief constructs an element in place at the beginning of list
+  * @complexity O(1)
+  */
+  template <typename ...Args>
+  constexpr
+  auto emplace_front(Args&& ...args)
+      -> T &
+  {
+    if ( m_head == nullptr || m_head->m_begin == 0 ) {
+      link_after(nullptr, create_filled_chunk(K - 1, std::forward<Args>(args)...));
+    } else {
+      std::construct_at(m_head->m_slots + m_head->m_begin - 1, std::forward<Args>(args)...);
+      --m_head->m_begin;
+      ++m_head->m_count;
+    }
+    ++m_size;
+    if ( m_cursor != m_head ) { ++m_cursor_base; }
+    return front();
+  }
+
+  /**
+  * @brief add element at end of list
+  * @complexity O(1)
+  */
+  constexpr auto push_back(const T &arg) -> void { emplace_back(arg); }
+  constexpr auto push_back(T &&arg)      -> void { emplace_back(std::move(arg)); }
+
+  /**
+  * @brief add element at the beginning of list
+  * @complexity O(1)
+  */
+  constexpr auto push_front(const T &arg) -> void { emplace_front(arg); }
+  constexpr auto push_front(T &&arg)      -> void { emplace_front(std::move(arg)); }
+
+  /**
+  * @brief add element at given position, shifts at most half a chunk
+  * @complexity O(min(pos, size - pos, |pos - last pos|) / K + K)
+  */
+  constexpr
+  auto push_at(const std::size_t pos, const T &arg)
+      -> void
+  {
+    if ( fails(pos >= m_size, Apology::invalid_position) )    { return; }
+    if (pos == 0)         { push_front(arg); return; }
+    if (pos == m_size-1)  { push_back(arg); return; }
+    const auto [chunk, off] = seek(pos);
+    emplace_into(chunk, off, arg);
+  }
+
+  constexpr
+  auto push_at(const std::size_t pos, T &&arg)
+      -> void
+  {
+    if ( fails(pos >= m_size, Apology::invalid_position) )    { return; }
+    if (pos == 0)         { push_front(std::move(arg)); return; }
+    if (pos == m_size-1)  { push_back(std::move(arg)); return; }
+    const auto [chunk, off] = seek(pos);
+    emplace_into(chunk, off, std::move(arg));
+  }
+
+  /**
+  * @brief remove last element
+  * @complexity O(1)
+  */
+  constexpr
+  auto pop_back()
+      -> void
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return; }
+    std::destroy_at(m_tail->data() + m_tail->m_count - 1);
+    --m_size;
+    if ( --m_tail->m_count == 0 ) { unlink(m_tail); }
+  }
+
+  /**
+  * @brief remove first element
+  * @complexity O(1)
+  */
+  constexpr
+  auto pop_front()
+      -> void
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return; }
+    std::destroy_at(m_head->data());
+    ++m_head->m_begin;
+    --m_size;
+    if ( m_cursor != m_head ) { --m_cursor_base; }
+    if ( --m_head->m_count == 0 ) { unlink(m_head); }
+  }
+
+  /**
+  * @brief removes and returns the first element, nothing when empty, never apologizes
+  * @complexity O(1)
+  */
+  constexpr
+  auto try_pop_front()
+      -> std::optional<T>
+  {
+    if ( is_empty() ) { return std::nullopt; }
+    std::optional<T> value( std::move(*m_head->data()) );
+    pop_front();
+    return value;
+  }
+
+  /**
+  * @brief removes and returns the last element, nothing when empty, never apologizes
+  * @complexity O(1)
+  */
+  constexpr
+  auto try_pop_back()
+      -> std::optional<T>
+  {
+    if ( is_empty() ) { return std::nullopt; }
+    std::optional<T> value( std::move(m_tail->data()[m_tail->m_count - 1]) );
+    pop_back();
+    return value;
+  }
+
+  /**
+  * @brief remove element at given position
+  * @complexity O(min(pos, size - pos, |pos - last pos|) / K + K)
+  */
+  constexpr
+  auto pop_at(const std::size_t pos)
+      -> void
+  {
+    if ( fails(is_empty(), Apology::empty) )     { return; }
+    if ( fails(pos >= m_size, Apology::invalid_position) )  { return; }
+    const auto [chunk, off] = seek(pos);
+    erase_from(chunk, off);
+  }
+
+  /**
+  * @brief check if the list is sorted ASC
+  * @complexity O(n)
+  */
+  [[nodiscard]]
+  constexpr
+  auto is_sorted() const
+      -> bool
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return false; }
+    return std::is_sorted(begin(), end());
+  }
+
+  /**
+  * @brief search for a value, chunk by chunk, vectorized for arithmetic T
+  * @complexity O(n)
+  */
+  [[nodiscard]]
+  constexpr
+  auto search(const T &target) const
+      -> bool
+  {
+    return locate(target) != -1;
+  }
+
+  /**
+  * @brief returns the location of the first element equal to target, vectorized for arithmetic T
+  * @complexity O(n)
+  * @return std::int64_t, -1 when not found
+  */
+  [[nodiscard]]
+  constexpr
+  auto locate(const T &target) const
+      -> std::int64_t
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return -1; }
+    std::int64_t base = 0;
+    for (const Chunk *it = m_head; it != nullptr; it = it->m_next) {
+      const T *first  = it->data();
+      const T *last   = first + it->m_count;
+      const T *found  = simd::find(first, last, target);
+      if ( found != last ) { return base + (found - first); }
+      base += it->m_count;
+    }
+    return -1;
+  }
+
+  /**
+  * @brief number of elements equal to target, vectorized for arithmetic T, 0 on an empty list
+  * @complexity O(n)
+  */
+  [[nodiscard]]
+  constexpr
+  auto count(const T &target) const
+      -> std::size_t
+  {
+    std::size_t n = 0;
+    for (const Chunk *it = m_head; it != nullptr; it = it->m_next) {
+      n += simd::count(it->data(), it->data() + it->m_count, target);
+    }
+    return n;
+  }
+
+  /**
+  * @brief smallest element, vectorized for arithmetic T
+  * @complexity O(n)
+  */
+  [[nodiscard]]
+  constexpr
+  auto min() const
+      -> T
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return failed(); }
+    return fold_chunks(m_head->data()[0], [](const T *first, const T *last, const T &acc) { return simd::min(first, last, acc); });
+  }
+
+  /**
+  * @brief largest element, vectorized for arithmetic T
+  * @complexity O(n)
+  */
+  [[nodiscard]]
+  constexpr
+  auto max() const
+      -> T
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return failed(); }
+    return fold_chunks(m_head->data()[0], [](const T *first, const T *last, const T &acc) { return simd::max(first, last, acc); });
+  }
+
+  /**
+  * @brief sum of all elements, vectorized for arithmetic T, see `simd::fold` for float rounding
+  * @complexity O(n)
+  */
+  [[nodiscard]]
+  constexpr
+  auto sum() const
+      -> T
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return failed(); }
+    return fold_chunks(T{}, [](const T *first, const T *last, const T &acc) { return simd::sum(first, last, acc); });
+  }
+
+  /**
+  * @brief erases the list
+  * @complexity O(n)
+  */
+  constexpr
+  auto clear()
+      -> void
+  {
+    if ( fails(is_empty(), Apology::empty) )  { return; }
+    release();
+  }
+}; // end of class Unrolled_list_
+
+#endif // UNROLLED_LIST_HPP
@@ -0,0 +1,40 @@
+/**
+* @file check.hpp
+* @brief the one assertion the test programs share: unlike `assert` it survives release builds,
+*   reports every failed condition, from any thread, and lets `main` return non zero at the end
+*/
+
+#ifndef CHECK_HPP
+#define CHECK_HPP
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+
+namespace check {
+
+inline std::atomic<int> failures = {0}; // checks may fail on several threads at once
+
+inline auto that(const bool ok, const char *what, const char *file, const int line)
+    -> bool
+{
+  if ( !ok ) {
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, what);
+    ++failures;
+  }
+  return ok;
+}
+
+/// @brief what `main` returns
+inline auto result()
+    -> int
+{
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+} // namespace check
+
+#define CHECK(cond) ::check::that(static_cast<bool>(cond), #cond, __FILE__, __LINE__)
+
+#endif // CHECK_HPP
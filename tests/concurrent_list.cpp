@@ -0,0 +1,85 @@
+/**
+* @file concurrent_list.cpp
+* @brief stress of `Concurrent_list_`: producers push unique ids at both ends while consumers
+*   pop and readers traverse, every id must come out exactly once and no traversal may meet a
+*   node twice; several thread mixes, run it under `-fsanitize=thread` to check the orderings
+*
+*   ./test_concurrent_list [ids per producer]
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "check.hpp"
+#include "concurrent_list.hpp"
+
+
+namespace {
+
+/// @brief producers push unique ids at both ends while consumers pop and readers traverse
+auto stress(const unsigned producers, const unsigned consumers, const unsigned readers, const int per_producer)
+    -> bool
+{
+  Concurrent_list_<int> list;
+  std::atomic<unsigned> producing = {producers};
+  std::atomic<bool>     bad_read  = {false};
+  std::vector<std::vector<int>> popped(consumers);
+  std::vector<std::thread> threads;
+  //
+  for (unsigned p = 0; p < producers; ++p) {
+    threads.emplace_back([&, p] {
+      for (int i = 0; i < per_producer; ++i) {
+        const int id = static_cast<int>(p) * per_producer + i;
+        if ( i % 2 == 0 ) { list.push_back(id); }
+        else              { list.push_front(id); }
+      }
+      producing.fetch_sub(1);
+    });
+  }
+  for (unsigned c = 0; c < consumers; ++c) {
+    threads.emplace_back([&, c] {
+      while ( producing.load() != 0 ) {
+        if ( auto id = list.try_pop_front() ) { popped[c].push_back(*id); }
+      }
+    });
+  }
+  const int total = static_cast<int>(producers) * per_producer;
+  for (unsigned r = 0; r < readers; ++r) {
+    threads.emplace_back([&] {
+      std::vector<char> seen(static_cast<std::size_t>(total));
+      while ( producing.load() != 0 ) {
+        std::fill(seen.begin(), seen.end(), 0);
+        for (const int id : list.reader()) { // one traversal never meets a node twice
+          if ( id < 0 || id >= total || seen[static_cast<std::size_t>(id)]++ != 0 ) { bad_read = true; }
+        }
+      }
+    });
+  }
+  for (auto& t : threads) { t.join(); }
+  //
+  std::vector<int> count(static_cast<std::size_t>(total));
+  for (const auto& ids : popped) { for (const int id : ids) { ++count[static_cast<std::size_t>(id)]; } }
+  list.for_each([&](const int id) { ++count[static_cast<std::size_t>(id)]; });
+  std::size_t left = 0;
+  list.for_each([&](int) { ++left; });
+  const bool once = std::all_of(count.begin(), count.end(), [](const int n) { return n == 1; });
+  return once && !bad_read && left == list.size();
+}
+
+} // namespace
+
+auto main(int argc, char **argv)
+    -> int
+{
+  const int ids = argc > 1 ? std::atoi(argv[1]) : 20'000;
+  //
+  CHECK(stress(1, 1, 0, ids));
+  CHECK(stress(4, 0, 0, ids));          // pushes only, everything stays in the list
+  CHECK(stress(4, 2, 2, ids));
+  CHECK(stress(2, 4, 1, ids));          // consumers mostly find the list empty
+  CHECK(stress(8, 4, 4, ids / 4));
+  return check::result();
+}
@@ -0,0 +1,57 @@
+/**
+* @file const_reads.cpp
+* @brief const lookups never move the cached cursor of `List_` or `Unrolled_list_`, so several
+*   threads may call `at() const`, `try_at`, `search` and `locate` on one list at once; run under
+*   ThreadSanitizer to see it
+*/
+
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "check.hpp"
+#include "list.hpp"
+#include "unrolled_list.hpp"
+
+
+namespace {
+
+template <typename List>
+auto read_concurrently(const List& list, const int n)
+    -> void
+{
+  std::vector<std::thread> readers;
+  for (unsigned t = 0; t < 4; ++t) {
+    readers.emplace_back([&list, n, t] {
+      std::mt19937 rng(t);
+      bool ok = true;
+      for (int k = 0; k < 20'000; ++k) {
+        const int pos = static_cast<int>(rng() % static_cast<unsigned>(n));
+        ok = ok && list.at(static_cast<std::size_t>(pos)) == pos * 2;
+        ok = ok && *list.try_at(static_cast<std::size_t>(pos)) == pos * 2;
+        if ( k % 256 == 0 ) { ok = ok && list.search(pos * 2) && list.locate(pos * 2) == pos; }
+      }
+      CHECK(ok);
+    });
+  }
+  for (auto& reader : readers) { reader.join(); }
+}
+
+} // namespace
+
+auto main()
+    -> int
+{
+  constexpr int n = 5000;
+  List_<int> list;
+  for (int i = 0; i < n; ++i) { list.push_back(i * 2); }
+  (void)list.at(n / 2); // a non const lookup leaves the cursor in the middle for the readers to use
+  read_concurrently(std::as_const(list), n);
+  //
+  Unrolled_list_<int> unrolled;
+  for (int i = 0; i < n; ++i) { unrolled.push_back(i * 2); }
+  (void)unrolled.at(n / 2);
+  read_concurrently(std::as_const(unrolled), n);
+  return check::result();
+}
@@ -0,0 +1,185 @@
+/**
+* @file constexpr.cpp
+* @brief what `freeze`, `StaticList_` and compile time lookup tables rely on, checked by the
+*   compiler: every `static_assert` below runs a list through constant evaluation, the program
+*   itself does nothing
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "list.hpp"
+#include "static_list.hpp"
+#include "unrolled_list.hpp"
+
+
+namespace {
+
+/// @brief true when `list` holds exactly `expected`, walked forwards and backwards
+template <typename List>
+constexpr auto holds(const List& list, const std::initializer_list<int> expected)
+    -> bool
+{
+  if ( list.size() != expected.size() ) { return false; }
+  auto it = expected.begin();
+  for (const int v : list) { if ( v != *it++ ) { return false; } }
+  auto back = expected.end();
+  for (auto r = list.rbegin(); r != list.rend(); ++r) { if ( *r != *--back ) { return false; } }
+  return true;
+}
+
+// construction, push / pop at both ends and in the middle
+static_assert([] {
+  List_<int> l{1, 2, 3};
+  l.push_back(4);
+  l.push_front(0);
+  l.push_at(2, 9);      // before the element at 2
+  l.pop_at(3);
+  l.pop_front();
+  l.pop_back();
+  return holds(l, {1, 9, 3}) && l.front() == 1 && l.back() == 3 && l.at(1) == 9;
+}());
+
+// iterator insert / erase, emplace
+static_assert([] {
+  List_<int> l{1, 4};
+  auto it = l.insert(std::next(l.cbegin()), 2);
+  l.insert(std::next(it), 3);
+  l.emplace(l.cend(), 5);
+  l.erase(l.cbegin());
+  l.emplace_front(0);
+  return holds(l, {0, 2, 3, 4, 5});
+}());
+
+// copies and moves
+static_assert([] {
+  const List_<int> a{3, 1, 2};
+  List_<int> b = a;
+  List_<int> c = std::move(b);
+  b = c;
+  return holds(a, {3, 1, 2}) && holds(b, {3, 1, 2}) && holds(c, {3, 1, 2});
+}());
+
+// sort, both orders and with a comparator
+static_assert([] {
+  List_<int> l{5, 3, 8, 1, 9, 2};
+  l.sort();
+  const bool asc = holds(l, {1, 2, 3, 5, 8, 9}) && l.is_sorted();
+  l.sort(true);
+  const bool desc = holds(l, {9, 8, 5, 3, 2, 1});
+  l.sort(std::less<>{});
+  return asc && desc && holds(l, {1, 2, 3, 5, 8, 9});
+}());
+
+// splice, split_at, concat, merge_sorted
+static_assert([] {
+  List_<int> a{1, 5};
+  List_<int> b{2, 3, 4};
+  a.splice(std::next(a.cbegin()), b);
+  const bool spliced = holds(a, {1, 2, 3, 4, 5}) && b.is_empty();
+  List_<int> rest = a.split_at(std::next(a.cbegin(), 3));
+  const bool split = holds(a, {1, 2, 3}) && holds(rest, {4, 5});
+  a.concat(std::move(rest));
+  List_<int> odd{1, 3, 7};
+  List_<int> even{2, 4, 6};
+  odd.merge_sorted(std::move(even));
+  return spliced && split && holds(a, {1, 2, 3, 4, 5}) && holds(odd, {1, 2, 3, 4, 6, 7});
+}());
+
+// remove / remove_if / unique / count, empty lists included
+static_assert([] {
+  List_<int> l{1, 1, 2, 3, 3, 3, 4, 1};
+  const std::size_t dup = l.unique();
+  const std::size_t one = l.remove(l.back());
+  const std::size_t even = l.remove_if([](const int v) { return v % 2 == 0; });
+  List_<int> none;
+  return dup == 3 && one == 2 && even == 2 && holds(l, {3})
+      && none.remove(1) == 0 && none.remove_if([](int) { return true; }) == 0 && none.unique() == 0
+      && none.count(1) == 0 && l.count(3) == 1;
+}());
+
+static_assert(Unrolled_list_<int>{}.count(1) == 0);
+
+// search and locate
+static_assert([] {
+  const List_<int> l{4, 8, 15, 16, 23, 42};
+  return l.search(15) && !l.search(7) && l.locate(23) == 4 && l.locate(7) == -1;
+}());
+
+// range construction and the range inserts
+static_assert([] {
+  const std::array<int, 3> a = {1, 2, 3};
+  List_<int> l(from_range, a);
+  l.append_range(a);
+  l.prepend_range(std::array<int, 1>{0});
+  l.insert_range(std::next(l.cbegin(), 4), std::array<int, 2>{7, 7});
+  return holds(l, {0, 1, 2, 3, 7, 7, 1, 2, 3});
+}());
+
+// to_array and freeze
+constexpr auto squares = freeze<[] {
+  List_<int> l;
+  for (int i = 0; i < 8; ++i) { l.push_back(i * i); }
+  return l;
+}>();
+static_assert(squares.size() == 8 && squares[0] == 0 && squares[3] == 9 && squares[7] == 49);
+
+constexpr auto sorted = freeze<[] {
+  List_<int> l{9, 4, 7, 1};
+  l.sort();
+  return l;
+}>();
+static_assert(sorted == std::array<int, 4>{1, 4, 7, 9});
+
+static_assert(List_<int>{5, 6, 7}.to_array<2>() == std::array<int, 2>{5, 6});
+
+// StaticList_: slots inside the object, reused through the free list, full reported not grown
+static_assert([] {
+  StaticList_<int, 4> l{1, 2, 3};
+  l.push_front(0);
+  const bool full = l.is_full() && !l.try_emplace_back(9);
+  l.pop_at(1);
+  l.push_at(0, 7);      // the first position prepends
+  l.pop_back();
+  l.push_at(2, 8);      // the last position appends
+  return full && holds(l, {7, 0, 2, 8});
+}());
+
+static_assert([] {
+  StaticList_<int, 8> l{5, 1, 4, 1, 3};
+  l.sort();
+  const bool sorted = holds(l, {1, 1, 3, 4, 5});
+  const std::size_t removed = l.remove(l.front());
+  auto it = l.insert(std::next(l.cbegin()), 6);
+  l.erase(it);
+  l.emplace_front(2);
+  return sorted && removed == 2 && holds(l, {2, 3, 4, 5}) && l.locate(4) == 2 && l.search(5);
+}());
+
+static_assert([] {
+  StaticList_<int, 3> a{1, 2, 3};
+  StaticList_<int, 3> b = a;
+  a.clear();
+  a.push_back(4);
+  StaticList_<int, 3> c = std::move(b);
+  return holds(a, {4}) && holds(c, {1, 2, 3}) && b.is_empty() && c.try_pop_front() == 1;
+}());
+
+// slots of trivial elements are left uninitialized, constructing a StaticList_ does not touch them
+static_assert(std::is_trivially_default_constructible_v<detail::Inline_slots<int, std::uint16_t, 1000>>);
+static_assert(std::is_trivially_destructible_v<detail::Index_slot<double, std::uint32_t>>);
+
+static_assert(sizeof(StaticList_<char, 100>::index_type) == 2 && sizeof(StaticList_<char, 70'000>::index_type) == 4);
+
+} // namespace
+
+auto main()
+    -> int
+{
+  return 0;
+}
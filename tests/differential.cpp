@@ -0,0 +1,231 @@
+/**
+* @file differential.cpp
+* @brief every sequential container against `std::list`: the same random push / pop / at /
+*   insert / erase / remove sequence runs on both and they must hold the same elements after
+*   every step, `List_` also splices, splits and merges; elements are strings so a lifetime bug
+*   reads freed memory under a sanitizer instead of passing by luck
+*
+*   ./test_differential [steps per container]
+*/
+
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <random>
+#include <string>
+#include "check.hpp"
+#include "index_list.hpp"
+#include "list.hpp"
+#include "persistent_list.hpp"
+#include "pool.hpp"
+#include "static_list.hpp"
+#include "unrolled_list.hpp"
+
+
+namespace {
+
+/// @brief long enough to live on the heap
+auto value(const int i)
+    -> std::string
+{
+  return "element number " + std::to_string(i) + " of the differential test";
+}
+
+/// @brief true when `list` and `model` hold the same elements, walked forwards and backwards
+template <typename List>
+auto same(const List& list, const std::list<std::string>& model)
+    -> bool
+{
+  if ( list.size() != model.size() ) { return false; }
+  auto it = model.begin();
+  for (const auto& v : list) { if ( v != *it++ ) { return false; } }
+  auto back = model.rbegin();
+  for (auto r = list.rbegin(); r != list.rend(); ++r) { if ( *r != *back++ ) { return false; } }
+  return true;
+}
+
+/**
+* @brief runs `steps` random operations on `list` and a `std::list`, checking after each one,
+*   `capacity` keeps a fixed size container from filling up
+*/
+template <typename List>
+auto run(const char *name, List& list, const unsigned seed, const int steps,
+         const std::size_t capacity = std::numeric_limits<std::size_t>::max())
+    -> void
+{
+  std::list<std::string> model;
+  std::mt19937 rng(seed);
+  const auto pick = [&rng](const std::size_t n) { return static_cast<std::size_t>(rng() % n); };
+  int next = 0;
+  for (int step = 0; step < steps; ++step) {
+    const std::size_t n     = model.size();
+    // grow while small, shrink while large, so sizes sweep 0 .. a few hundred
+    const bool        grow  = n < capacity && pick(400) >= n;
+    switch ( pick(6) + (grow ? 0 : 6) ) {
+      case 0:
+        list.push_back(value(next));
+        model.push_back(value(next++));
+        break;
+      case 1:
+        list.push_front(value(next));
+        model.push_front(value(next++));
+        break;
+      case 2: case 3:
+        if ( n == 0 ) { break; }
+        {
+          // like `List_`: the first position prepends, the last appends, any other inserts before the element there
+          const std::size_t pos = pick(n);
+          list.push_at(pos, value(next));
+          if      ( pos == 0 )     { model.push_front(value(next++)); }
+          else if ( pos == n - 1 ) { model.push_back(value(next++)); }
+          else                     { model.insert(std::next(model.begin(), static_cast<std::ptrdiff_t>(pos)), value(next++)); }
+        }
+        break;
+      case 4: case 5:
+        if constexpr ( requires { list.insert(list.cbegin(), value(0)); } ) {
+          const std::size_t pos = pick(n + 1);
+          const auto it = list.insert(std::next(list.cbegin(), static_cast<std::ptrdiff_t>(pos)), value(next));
+          CHECK(*it == value(next));
+          model.insert(std::next(model.begin(), static_cast<std::ptrdiff_t>(pos)), value(next++));
+        }
+        break;
+      case 6:
+        if ( n == 0 ) { break; }
+        list.pop_back();
+        model.pop_back();
+        break;
+      case 7:
+        if ( n == 0 ) { break; }
+        list.pop_front();
+        model.pop_front();
+        break;
+      case 8:
+        if ( n == 0 ) { break; }
+        {
+          const std::size_t pos = pick(n);
+          list.pop_at(pos);
+          model.erase(std::next(model.begin(), static_cast<std::ptrdiff_t>(pos)));
+        }
+        break;
+      case 9:
+        if ( n == 0 ) { break; }
+        if constexpr ( requires { list.erase(list.cbegin()); } ) {
+          const std::size_t pos = pick(n);
+          list.erase(std::next(list.cbegin(), static_cast<std::ptrdiff_t>(pos)));
+          model.erase(std::next(model.begin(), static_cast<std::ptrdiff_t>(pos)));
+        }
+        break;
+      case 10:
+        if ( n == 0 ) { break; }
+        if constexpr ( requires { list.remove(value(0)); } ) {
+          // the removed value is one of the elements, the containers must not read it after freeing it
+          const std::size_t pos = pick(n);
+          const std::size_t removed = list.remove(list.at(pos));
+          const std::size_t before  = model.size();
+          const std::string target  = *std::next(model.begin(), static_cast<std::ptrdiff_t>(pos));
+          model.remove(target);
+          CHECK(removed == before - model.size());
+        }
+        break;
+      default:
+        if ( n == 0 ) { break; }
+        {
+          const std::size_t pos = pick(n);
+          CHECK(list.at(pos) == *std::next(model.begin(), static_cast<std::ptrdiff_t>(pos)));
+        }
+        break;
+    }
+    if ( !CHECK(list.size() == model.size()) ) { std::fprintf(stderr, "  %s, step %d\n", name, step); return; }
+    if ( !model.empty() && !(CHECK(list.front() == model.front()) && CHECK(list.back() == model.back())) ) {
+      std::fprintf(stderr, "  %s, step %d\n", name, step);
+      return;
+    }
+    if ( (step % 64 == 0 || step + 1 == steps) && !CHECK(same(list, model)) ) {
+      std::fprintf(stderr, "  %s, step %d\n", name, step);
+      return;
+    }
+  }
+}
+
+/// @brief random whole and partial splices, split_at, concat and merge_sorted of `List_` against `std::list`
+auto run_splices(const unsigned seed, const int steps)
+    -> void
+{
+  List_<std::string>      a, b;
+  std::list<std::string>  ma, mb;
+  std::mt19937 rng(seed);
+  const auto pick = [&rng](const std::size_t n) { return static_cast<std::size_t>(rng() % n); };
+  const auto at   = [](auto& list, const std::size_t pos) { return std::next(list.begin(), static_cast<std::ptrdiff_t>(pos)); };
+  int next = 0;
+  for (int step = 0; step < steps; ++step) {
+    switch ( pick(6) ) {
+      case 0: // refill b
+        for (std::size_t k = pick(20); k != 0; --k) { b.push_back(value(next)); mb.push_back(value(next++)); }
+        break;
+      case 1: { // all of b into a
+        const std::size_t pos = pick(ma.size() + 1);
+        a.splice(at(a, pos), b);
+        ma.splice(at(ma, pos), mb);
+        break;
+      }
+      case 2: { // a range of b into a
+        const std::size_t first = pick(mb.size() + 1);
+        const std::size_t last  = first + pick(mb.size() - first + 1);
+        const std::size_t pos   = pick(ma.size() + 1);
+        a.splice(at(a, pos), b, at(b, first), at(b, last));
+        ma.splice(at(ma, pos), mb, at(mb, first), at(mb, last));
+        break;
+      }
+      case 3: { // a range of a moved within a, outside the range
+        if ( ma.size() < 2 ) { break; }
+        const std::size_t first = 1 + pick(ma.size() - 1);
+        const std::size_t last  = first + pick(ma.size() - first + 1);
+        const std::size_t pos   = pick(first);
+        a.splice(at(a, pos), a, at(a, first), at(a, last));
+        ma.splice(at(ma, pos), ma, at(ma, first), at(ma, last));
+        break;
+      }
+      case 4: { // split a, then put the tail back with concat
+        const std::size_t pos = pick(ma.size() + 1);
+        List_<std::string> rest = a.split_at(at(a, pos));
+        std::list<std::string> mrest;
+        mrest.splice(mrest.begin(), ma, at(ma, pos), ma.end());
+        CHECK(same(rest, mrest));
+        a.concat(std::move(rest));
+        ma.splice(ma.end(), mrest);
+        break;
+      }
+      default: { // sort both and merge b into a
+        if ( !a.is_empty() ) { a.sort(); }
+        if ( !b.is_empty() ) { b.sort(); }
+        ma.sort();
+        mb.sort();
+        a.merge_sorted(std::move(b));
+        ma.merge(mb);
+        break;
+      }
+    }
+    if ( !CHECK(same(a, ma)) || !CHECK(same(b, mb)) ) { std::fprintf(stderr, "  List_ splices, step %d\n", step); return; }
+    if ( ma.size() > 2000 ) { a.clear(); ma.clear(); }
+  }
+}
+
+} // namespace
+
+auto main(int argc, char **argv)
+    -> int
+{
+  const int steps = argc > 1 ? std::atoi(argv[1]) : 20'000;
+  //
+  { List_<std::string> l;                                    run("List_", l, 1, steps); }
+  { Node_pool pool; pmr::List_<std::string> l(&pool);        run("pmr::List_ over Node_pool", l, 2, steps); }
+  { Unrolled_list_<std::string, 4> l;                        run("Unrolled_list_<4>", l, 3, steps); }
+  { Unrolled_list_<std::string> l;                           run("Unrolled_list_", l, 4, steps); }
+  { StaticList_<std::string, 300> l;                         run("StaticList_<300>", l, 5, steps, 300); }
+  { Index_list_<std::string> l;                              run("Index_list_", l, 6, steps); }
+  { Persistent_list_<std::string> l;                         run("Persistent_list_", l, 7, steps); }
+  run_splices(8, steps / 4);
+  return check::result();
+}
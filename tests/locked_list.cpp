@@ -0,0 +1,175 @@
+/**
+* @file locked_list.cpp
+* @brief `Locked_list_` under concurrent `push_after_value` / `push_before_value` / `pop_value`:
+*   on disjoint regions every thread's region must end exactly like a sequential `std::list` run
+*   of the same operations, on one shared region every surviving value must sit between the keys
+*   it was inserted around; the list is walked forwards and backwards with readers running
+*
+*   ./test_locked_list [ops per thread]
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iterator>
+#include <list>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "check.hpp"
+#include "locked_list.hpp"
+
+
+namespace {
+
+constexpr int threads = 4;
+
+/// @brief the elements walked forwards, which must be the backward walk reversed and `size()` long
+auto contents(const Locked_list_<int>& list)
+    -> std::vector<int>
+{
+  std::vector<int> forward, backward;
+  list.for_each([&forward](const int v) { forward.push_back(v); });
+  list.for_each_reverse([&backward](const int v) { backward.push_back(v); });
+  CHECK(forward.size() == list.size());
+  CHECK(std::equal(forward.begin(), forward.end(), backward.rbegin(), backward.rend()));
+  return forward;
+}
+
+/// @brief starts `threads` writers running `write(t)` and one reader walking both ways until they finish
+template <typename Write>
+auto race(const Locked_list_<int>& list, Write write)
+    -> void
+{
+  std::atomic<bool> done = {false};
+  std::thread reader([&] {
+    while ( !done.load() ) {
+      std::size_t n = 0;
+      list.for_each([&n](int) { ++n; });
+      list.for_each_reverse([&n](int) { --n; });
+      (void)list.search(-1);
+    }
+  });
+  std::vector<std::thread> writers;
+  for (int t = 0; t < threads; ++t) { writers.emplace_back(write, t); }
+  for (auto& w : writers) { w.join(); }
+  done = true;
+  reader.join();
+}
+
+/**
+* @brief thread `t` owns keys `t * span + 1 .. t * span + span - 1` and what it inserts around
+*   them, the keys `t * span` fence the regions apart and nobody touches them
+*/
+auto disjoint(const int ops)
+    -> void
+{
+  constexpr int span = 64;
+  Locked_list_<int> list;
+  for (int k = 0; k <= threads * span; ++k) { list.push_back(k); }
+  std::vector<std::list<int>> models(threads);
+  race(list, [&](const int t) {
+    std::list<int>& model = models[static_cast<std::size_t>(t)];
+    for (int k = t * span + 1; k < (t + 1) * span; ++k) { model.push_back(k); }
+    std::vector<int> mine(model.begin(), model.end());
+    std::mt19937 rng(static_cast<unsigned>(t));
+    int next = (t + 1) * 1'000'000;
+    bool ok = true;
+    for (int i = 0; i < ops; ++i) {
+      const int anchor = mine[rng() % mine.size()];
+      const auto found = std::find(model.begin(), model.end(), anchor);
+      switch ( rng() % 4 ) {
+        case 0:
+          ok = ok && list.push_after_value(anchor, next) == (found != model.end());
+          if ( found != model.end() ) { model.insert(std::next(found), next); mine.push_back(next); }
+          ++next;
+          break;
+        case 1:
+          ok = ok && list.push_before_value(anchor, next) == (found != model.end());
+          if ( found != model.end() ) { model.insert(found, next); mine.push_back(next); }
+          ++next;
+          break;
+        default: // keys of this region included, later pushes around them then find nothing
+          list.pop_value(anchor);
+          model.remove(anchor);
+          break;
+      }
+    }
+    CHECK(ok);
+  });
+  std::vector<int> expected;
+  for (int t = 0; t < threads; ++t) {
+    expected.push_back(t * span);
+    expected.insert(expected.end(), models[static_cast<std::size_t>(t)].begin(), models[static_cast<std::size_t>(t)].end());
+  }
+  expected.push_back(threads * span);
+  CHECK(contents(list) == expected);
+}
+
+/**
+* @brief every thread inserts around the same few keys and around its own values, and pops some
+*   of its own values; nobody pops a key, so each survivor must still lie between the key it was
+*   inserted after ( or the one before the key it was inserted before ) and the following key
+*/
+auto overlapping(const int ops)
+    -> void
+{
+  constexpr int keys = 8;
+  Locked_list_<int> list;
+  for (int k = 0; k < keys; ++k) { list.push_back(k); }
+  std::vector<std::unordered_map<int, int>> gaps(threads); // survivor -> the key starting its gap
+  race(list, [&](const int t) {
+    std::unordered_map<int, int>& gap = gaps[static_cast<std::size_t>(t)];
+    std::vector<int> live;
+    std::mt19937 rng(static_cast<unsigned>(t) + 100);
+    int next = (t + 1) * 1'000'000;
+    bool ok = true;
+    for (int i = 0; i < ops; ++i) {
+      const unsigned what = rng() % 5;
+      if ( what == 4 && !live.empty() ) {
+        const std::size_t at = rng() % live.size();
+        list.pop_value(live[at]);
+        gap.erase(live[at]);
+        live[at] = live.back();
+        live.pop_back();
+        continue;
+      }
+      if ( what >= 2 && !live.empty() ) { // around one of its own values, into the same gap
+        const int anchor = live[rng() % live.size()];
+        ok = ok && ( what == 2 ? list.push_after_value(anchor, next) : list.push_before_value(anchor, next) );
+        gap[next] = gap[anchor];
+      } else {
+        const int key = 1 + static_cast<int>(rng() % (keys - 1));
+        ok = ok && ( what == 0 ? list.push_after_value(key, next) : list.push_before_value(key, next) );
+        gap[next] = what == 0 ? key : key - 1;
+      }
+      live.push_back(next++);
+    }
+    CHECK(ok);
+  });
+  const std::vector<int> left = contents(list);
+  std::size_t survivors = 0;
+  for (const auto& gap : gaps) { survivors += gap.size(); }
+  CHECK(left.size() == keys + survivors);
+  int current = -1; // the last key walked past
+  bool placed = true;
+  for (const int v : left) {
+    if ( v < keys ) { placed = placed && v == current + 1; current = v; continue; }
+    const auto& gap = gaps[static_cast<std::size_t>(v / 1'000'000 - 1)];
+    const auto it   = gap.find(v);
+    placed = placed && it != gap.end() && it->second == current;
+  }
+  CHECK(placed && current == keys - 1);
+}
+
+} // namespace
+
+auto main(int argc, char **argv)
+    -> int
+{
+  const int ops = argc > 1 ? std::atoi(argv[1]) : 3'000;
+  disjoint(ops);
+  overlapping(ops);
+  return check::result();
+}
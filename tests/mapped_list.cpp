@@ -0,0 +1,107 @@
+/**
+* @file mapped_list.cpp
+* @brief `Mapped_list_` keeps its list across opens: after a clean close, after growing the file,
+*   after a process died without `sync()`, and it refuses files holding another element type
+*   or a header whose links point outside the used slots
+*/
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "check.hpp"
+#include "mapped_list.hpp"
+
+
+namespace {
+
+/// @brief the list in `path` holds `first, first + 1, ..., first + n - 1`, walked both ways
+auto holds_run(const std::string& path, const int first, const int n)
+    -> bool
+{
+  Mapped_list_<int> list(path);
+  if ( list.size() != static_cast<std::size_t>(n) ) { return false; }
+  int expected = first;
+  for (const int v : list) { if ( v != expected++ ) { return false; } }
+  for (auto r = list.rbegin(); r != list.rend(); ++r) { if ( *r != --expected ) { return false; } }
+  return true;
+}
+
+template <typename List>
+auto refused(const std::string& path)
+    -> bool
+{
+  try {
+    List list(path);
+    return false;
+  } catch (const std::runtime_error&) {
+    return true;
+  }
+}
+
+/// @brief overwrites the header field at `offset` with `value`
+auto poke(const std::string& path, const long offset, const std::uint32_t value)
+    -> void
+{
+  std::FILE *file = std::fopen(path.c_str(), "r+b");
+  if ( !CHECK(file != nullptr) ) { return; }
+  std::fseek(file, offset, SEEK_SET);
+  std::fwrite(&value, sizeof value, 1, file);
+  std::fclose(file);
+}
+
+} // namespace
+
+auto main()
+    -> int
+{
+  const std::string path = (std::filesystem::temp_directory_path() / ("d_list_mapped_" + std::to_string(::getpid()))).string();
+  std::filesystem::remove(path);
+  //
+  { // grows from 4 slots, free slots get reused, closes cleanly
+    Mapped_list_<int> list(path, 4);
+    for (int i = 0; i < 1000; ++i) { list.push_back(i); }
+    list.pop_front();
+    list.pop_front();
+    list.push_front(1);
+    list.push_front(0);
+    CHECK(list.capacity() >= 1000);
+  }
+  CHECK(holds_run(path, 0, 1000));
+  { // sort relinks without moving elements, the next open sees the new order
+    Mapped_list_<int> list(path);
+    list.sort(true);
+    list.sort();
+  }
+  CHECK(holds_run(path, 0, 1000));
+  // a process dying between operations, without sync() or destructors, leaves a consistent list
+  const pid_t child = ::fork();
+  if ( child == 0 ) {
+    Mapped_list_<int> list(path);
+    for (int i = 1000; i < 5000; ++i) { list.push_back(i); } // grows the file again
+    for (int i = 0; i < 10; ++i) { list.pop_front(); }
+    ::_exit(0);
+  }
+  int status = 0;
+  CHECK(child > 0 && ::waitpid(child, &status, 0) == child && WIFEXITED(status));
+  CHECK(holds_run(path, 10, 4990));
+  //
+  CHECK(refused<Mapped_list_<double>>(path));
+  // head, tail and free live at bytes 24, 28 and 32 of the header, each one damaged on its own
+  const std::string good = path + ".good";
+  std::filesystem::copy_file(path, good, std::filesystem::copy_options::overwrite_existing);
+  for (const long field : {24L, 28L, 32L}) {
+    std::filesystem::copy_file(good, path, std::filesystem::copy_options::overwrite_existing);
+    poke(path, field, 1u << 30);
+    CHECK(refused<Mapped_list_<int>>(path));
+  }
+  std::filesystem::copy_file(good, path, std::filesystem::copy_options::overwrite_existing);
+  poke(path, 24, ~0u); // an empty head on a list of 4990
+  CHECK(refused<Mapped_list_<int>>(path));
+  std::filesystem::remove(good);
+  std::filesystem::remove(path);
+  return check::result();
+}
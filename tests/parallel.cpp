@@ -0,0 +1,216 @@
+/**
+* @file parallel.cpp
+* @brief every `par::` algorithm against its `std::` counterpart on sizes around where lists
+*   start being split, `par::sort` must be stable and relink nodes without copying elements,
+*   and a throwing callable must reach the caller after every segment finished, with the list
+*   still holding all its elements; meant to be run under ThreadSanitizer as well
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "check.hpp"
+#include "list.hpp"
+#include "parallel.hpp"
+
+
+namespace {
+
+/// @brief counts its copies and moves, the key orders, the sequence number tells ties apart
+struct Item {
+  static inline std::atomic<int> s_copies = {0};
+  //
+  int m_key = {};
+  int m_seq = {};
+  //
+  Item(const int key, const int seq) : m_key(key), m_seq(seq) {}
+  Item(const Item& other) : m_key(other.m_key), m_seq(other.m_seq) { ++s_copies; }
+  Item(Item&& other) noexcept : m_key(other.m_key), m_seq(other.m_seq) { ++s_copies; }
+  auto operator=(const Item& other) -> Item& { m_key = other.m_key; m_seq = other.m_seq; ++s_copies; return *this; }
+  auto operator=(Item&& other) noexcept -> Item& { m_key = other.m_key; m_seq = other.m_seq; ++s_copies; return *this; }
+}; // end of struct Item
+
+/// @brief 2x2 matrices modulo 2^32: multiplication is associative but not commutative
+struct Mat {
+  std::uint32_t m_a = 1, m_b = 0, m_c = 0, m_d = 1;
+  //
+  friend constexpr auto operator==(const Mat&, const Mat&) noexcept -> bool = default;
+}; // end of struct Mat
+
+constexpr auto times = [](const Mat& x, const Mat& y) {
+  return Mat{x.m_a * y.m_a + x.m_b * y.m_c, x.m_a * y.m_b + x.m_b * y.m_d,
+             x.m_c * y.m_a + x.m_d * y.m_c, x.m_c * y.m_b + x.m_d * y.m_d};
+};
+
+template <typename T>
+auto same(const List_<T>& list, const std::vector<T>& model)
+    -> bool
+{
+  return list.size() == model.size() && std::equal(list.begin(), list.end(), model.begin());
+}
+
+auto numbers(const std::size_t n, const unsigned seed)
+    -> std::vector<int>
+{
+  std::mt19937 rng(seed);
+  std::vector<int> v(n);
+  for (int& x : v) { x = static_cast<int>(rng() % 2000) - 1000; }
+  return v;
+}
+
+auto algorithms(const std::size_t n, par::Thread_pool& pool)
+    -> void
+{
+  const std::vector<int> v = numbers(n, static_cast<unsigned>(n));
+  {
+    List_<int> list(from_range, v);
+    std::vector<int> model = v;
+    par::for_each(list, [](int& x) { x = 3 * x + 1; }, pool);
+    std::for_each(model.begin(), model.end(), [](int& x) { x = 3 * x + 1; });
+    CHECK(same(list, model));
+    par::transform(list, [](const int x) { return x * x - 7; }, pool);
+    std::transform(model.begin(), model.end(), model.begin(), [](const int x) { return x * x - 7; });
+    CHECK(same(list, model));
+  }
+  {
+    const List_<int> list(from_range, v);
+    CHECK(par::reduce(list, 5, std::plus<>{}, pool) == std::accumulate(v.begin(), v.end(), 5));
+    const auto even = [](const int x) { return x % 2 == 0; };
+    CHECK(par::count_if(list, even, pool) == static_cast<std::size_t>(std::count_if(v.begin(), v.end(), even)));
+    // the segments must be combined in list order
+    List_<Mat> mats;
+    std::vector<Mat> model;
+    for (const int x : v) {
+      const auto u = static_cast<std::uint32_t>(x);
+      mats.push_back(Mat{u, 1, u ^ 5u, 2});
+      model.push_back(Mat{u, 1, u ^ 5u, 2});
+    }
+    CHECK(par::reduce(mats, Mat{}, times, pool) == std::accumulate(model.begin(), model.end(), Mat{}, times));
+  }
+  {
+    List_<int> list(from_range, v);
+    std::vector<int> model = v;
+    par::sort(list, std::less<>{}, pool);
+    std::sort(model.begin(), model.end());
+    CHECK(same(list, model));
+    par::sort(list, std::greater<>{}, pool);
+    std::sort(model.begin(), model.end(), std::greater<>{});
+    CHECK(same(list, model));
+  }
+}
+
+/// @brief few keys so most elements tie, the order of ties and every element's address survive the sort
+auto stable_sort(const std::size_t n, par::Thread_pool& pool)
+    -> void
+{
+  std::mt19937 rng(static_cast<unsigned>(n) + 1);
+  List_<Item> list;
+  std::vector<int> keys;
+  for (std::size_t i = 0; i < n; ++i) {
+    keys.push_back(static_cast<int>(rng() % 50));
+    list.emplace_back(keys.back(), static_cast<int>(i));
+  }
+  std::vector<const Item *> address(n);
+  for (const Item& item : list) { address[static_cast<std::size_t>(item.m_seq)] = &item; }
+  //
+  std::vector<int> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&keys](const int a, const int b) {
+    return keys[static_cast<std::size_t>(a)] < keys[static_cast<std::size_t>(b)];
+  });
+  Item::s_copies = 0;
+  par::sort(list, [](const Item& a, const Item& b) { return a.m_key < b.m_key; }, pool);
+  CHECK(Item::s_copies == 0);
+  CHECK(list.size() == n);
+  auto expected = order.begin();
+  bool in_place = true;
+  bool stable   = true;
+  for (const Item& item : list) {
+    stable   = stable && item.m_seq == *expected++;
+    in_place = in_place && address[static_cast<std::size_t>(item.m_seq)] == &item;
+  }
+  CHECK(stable);
+  CHECK(in_place);
+}
+
+/// @brief a throw on any thread, the caller's included, comes out of `run` once every index ran
+auto throwing(par::Thread_pool& pool)
+    -> void
+{
+  std::atomic<std::size_t> ran = {0};
+  bool caught = false;
+  try {
+    pool.run(1000, [&ran](const std::size_t i) {
+      ++ran;
+      if ( i % 7 == 3 ) { throw std::runtime_error("index"); }
+    });
+  } catch (const std::runtime_error&) {
+    caught = true;
+  }
+  CHECK(caught && ran == 1000);
+  //
+  const std::vector<int> v = numbers(40'000, 9);
+  List_<int> list(from_range, v);
+  caught = false;
+  try {
+    par::for_each(list, [](int&) { throw std::logic_error("every element"); }, pool);
+  } catch (const std::logic_error&) {
+    caught = true;
+  }
+  CHECK(caught && same(list, v));
+  caught = false;
+  try {
+    const int bad = v[30'000];
+    par::count_if(list, [bad](const int x) -> bool { if ( x == bad ) { throw 42; } return true; }, pool);
+  } catch (const int e) {
+    caught = e == 42;
+  }
+  CHECK(caught);
+  // thrown while sorting segments, then while merging them: no element is lost either way
+  std::vector<int> sorted = v;
+  std::sort(sorted.begin(), sorted.end());
+  std::atomic<int> total = {0};
+  par::sort(list, [&total](const int a, const int b) { ++total; return a < b; }, pool);
+  for (const int limit : {1000, total - 100}) {
+    std::atomic<int> calls = {0};
+    caught = false;
+    list = List_<int>(from_range, v);
+    try {
+      par::sort(list, [&calls, limit](const int a, const int b) {
+        if ( ++calls == limit ) { throw std::runtime_error("compare"); }
+        return a < b;
+      }, pool);
+    } catch (const std::runtime_error&) {
+      caught = true;
+    }
+    std::vector<int> kept(list.begin(), list.end());
+    std::sort(kept.begin(), kept.end());
+    CHECK(caught && kept == sorted);
+  }
+}
+
+} // namespace
+
+auto main()
+    -> int
+{
+  // three workers, so segments run in parallel even on a single core
+  par::Thread_pool pool(3);
+  const std::size_t m = par::min_segment;
+  for (const std::size_t n : {std::size_t{0}, std::size_t{1}, m - 1, m, m + 1, 2 * m - 1, 2 * m, 3 * m + 5,
+                              4 * m - 1, 4 * m, 4 * m + 1, 9 * m + 7}) {
+    algorithms(n, pool);
+    stable_sort(n, pool);
+  }
+  par::Thread_pool none(0);
+  algorithms(3 * m, none);
+  stable_sort(3 * m, none);
+  throwing(pool);
+  return check::result();
+}
@@ -0,0 +1,73 @@
+/**
+* @file persistent_list.cpp
+* @brief `Persistent_list_` snapshots never change: each one is checked against a copy taken
+*   when it was made, while the writer keeps pushing and popping, on reader threads too
+*
+*   ./test_persistent_list [writes]
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+#include "check.hpp"
+#include "persistent_list.hpp"
+
+
+namespace {
+
+template <typename View>
+auto same(const View& view, const std::list<std::string>& expected)
+    -> bool
+{
+  return view.size() == expected.size() && std::equal(view.begin(), view.end(), expected.begin(), expected.end());
+}
+
+} // namespace
+
+auto main(int argc, char **argv)
+    -> int
+{
+  const int writes = argc > 1 ? std::atoi(argv[1]) : 20'000;
+  //
+  using List = Persistent_list_<std::string>;
+  List list;
+  std::list<std::string> model;
+  std::vector<std::pair<List::snapshot_type, std::list<std::string>>> kept;
+  for (int i = 0; i < writes; ++i) {
+    const std::string v = std::to_string(i);
+    switch ( i % 7 ) {
+      case 0: case 1: case 2: list.push_back(v);  model.push_back(v);  break;
+      case 3: case 4:         list.push_front(v); model.push_front(v); break;
+      case 5: if ( !model.empty() ) { list.pop_front(); model.pop_front(); } break;
+      default:
+        if ( model.size() > 2 ) {
+          const std::size_t pos = static_cast<std::size_t>(i) % model.size();
+          list.at(pos) = v;
+          *std::next(model.begin(), static_cast<std::ptrdiff_t>(pos)) = v;
+        }
+        break;
+    }
+    if ( i % 500 == 0 ) { kept.emplace_back(list.snapshot(), model); }
+  }
+  CHECK(same(list, model));
+  for (const auto& [view, expected] : kept) { CHECK(same(view, expected)); }
+  //
+  // readers check their snapshots and drop them on their own threads while the writer carries on
+  std::vector<std::thread> readers;
+  for (auto& entry : kept) {
+    readers.emplace_back([entry = std::move(entry)]() mutable {
+      for (int round = 0; round < 20; ++round) { CHECK(same(entry.first, entry.second)); }
+    });
+  }
+  kept.clear();
+  for (int i = 0; i < writes; ++i) {
+    if ( i % 2 == 0 ) { list.push_back(std::to_string(i)); }
+    else              { list.pop_front(); }
+  }
+  for (auto& t : readers) { t.join(); }
+  return check::result();
+}
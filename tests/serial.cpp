@@ -0,0 +1,181 @@
+/**
+* @file serial.cpp
+* @brief `List_::save` / `load`: round trips through streams and `FILE *`, then every kind of
+*   bad input, truncated at each byte, a foreign header, and counts or string lengths far beyond
+*   the data, must make `load` return false and leave the list as it was
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include "check.hpp"
+#include "list.hpp"
+#include "pool.hpp"
+#include "serial.hpp"
+
+
+namespace {
+
+struct Point {
+  std::int32_t m_x = {};
+  std::int32_t m_y = {};
+  double       m_w = {};
+  //
+  friend constexpr auto operator==(const Point&, const Point&) noexcept -> bool = default;
+}; // end of struct Point
+
+template <typename List>
+auto equal(const List& a, const List& b)
+    -> bool
+{
+  return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+}
+
+template <typename List>
+auto saved(const List& list)
+    -> std::string
+{
+  std::ostringstream out;
+  CHECK(list.save(out));
+  return out.str();
+}
+
+/// @brief loads `bytes` into `list`, which must come out equal to `expected`
+template <typename List>
+auto loads(List& list, const std::string& bytes, const List& expected, const bool ok)
+    -> bool
+{
+  std::istringstream in(bytes);
+  return list.load(in) == ok && equal(list, expected);
+}
+
+template <typename List>
+auto round_trip(const List& list)
+    -> void
+{
+  List copy;
+  CHECK(loads(copy, saved(list), list, true));
+  // through FILE *, with the list loaded into holding something else first
+  std::FILE *file = std::tmpfile();
+  if ( !CHECK(file != nullptr) ) { return; }
+  CHECK(list.save(file));
+  std::rewind(file);
+  List other;
+  other.push_back(typename List::value_type{});
+  CHECK(other.load(file) && equal(other, list));
+  std::fclose(file);
+}
+
+/// @brief every proper prefix of a saved list is refused and leaves the target alone
+template <typename List>
+auto truncated(const List& list)
+    -> void
+{
+  const std::string bytes = saved(list);
+  List target;
+  target.push_back(typename List::value_type{});
+  const List before = target;
+  for (std::size_t n = 0; n < bytes.size(); ++n) {
+    if ( !CHECK(loads(target, bytes.substr(0, n), before, false)) ) { std::fprintf(stderr, "  prefix of %zu bytes\n", n); return; }
+  }
+}
+
+auto with_header(std::string bytes, const serial::Header& header)
+    -> std::string
+{
+  std::memcpy(bytes.data(), &header, sizeof header);
+  return bytes;
+}
+
+auto read_header(const std::string& bytes)
+    -> serial::Header
+{
+  serial::Header header;
+  std::memcpy(&header, bytes.data(), sizeof header);
+  return header;
+}
+
+auto corrupted_header()
+    -> void
+{
+  List_<int> list{1, 2};
+  const std::string bytes = saved(list);
+  List_<int> target{7};
+  const List_<int> before = target;
+  //
+  serial::Header h = read_header(bytes);
+  h.m_magic[0] = 'X';
+  CHECK(loads(target, with_header(bytes, h), before, false));
+  h = read_header(bytes);
+  h.m_version = 99;
+  CHECK(loads(target, with_header(bytes, h), before, false));
+  h = read_header(bytes);
+  h.m_value_size = 8;
+  CHECK(loads(target, with_header(bytes, h), before, false));
+  h = read_header(bytes);
+  h.m_layout = static_cast<std::uint8_t>(serial::Layout::strings);
+  CHECK(loads(target, with_header(bytes, h), before, false));
+  h = read_header(bytes);
+  h.m_little = !h.m_little;
+  CHECK(loads(target, with_header(bytes, h), before, false));
+  // a list of ints is not a list of strings and the other way round
+  List_<std::string> strings{"a"};
+  const List_<std::string> strings_before = strings;
+  CHECK(loads(strings, bytes, strings_before, false));
+}
+
+/// @brief counts and lengths far beyond the data fail quickly without allocating for them
+auto absurd_sizes()
+    -> void
+{
+  const std::string ints = saved(List_<int>{1, 2});
+  for (const std::uint64_t count : {std::uint64_t{1} << 30, std::uint64_t{1} << 62, ~std::uint64_t{0}}) {
+    serial::Header h = read_header(ints);
+    h.m_count = count;
+    Node_pool pool;
+    pmr::List_<int> pooled(&pool);
+    pooled.push_back(7);
+    std::istringstream in(with_header(ints, h));
+    CHECK(!pooled.load(in) && pooled.size() == 1 && pooled.front() == 7);
+    List_<int> plain{7};
+    CHECK(loads(plain, with_header(ints, h), List_<int>{7}, false));
+  }
+  //
+  std::string strings = saved(List_<std::string>{"hello", "world"});
+  for (const std::uint64_t length : {std::uint64_t{1} << 40, std::uint64_t{1} << 62, ~std::uint64_t{0}}) {
+    std::string bad = strings;
+    std::memcpy(bad.data() + sizeof(serial::Header), &length, sizeof length);
+    List_<std::string> target{"kept"};
+    CHECK(loads(target, bad, List_<std::string>{"kept"}, false));
+  }
+}
+
+} // namespace
+
+auto main()
+    -> int
+{
+  round_trip(List_<int>{});
+  round_trip(List_<int>{3, 1, 4, 1, 5, 9, 2, 6});
+  {
+    List_<int> big;
+    for (int i = 0; i < 100'000; ++i) { big.push_back(i * 7); } // several read batches
+    round_trip(big);
+    Node_pool pool;
+    pmr::List_<int> pooled(&pool);
+    std::istringstream in(saved(big));
+    CHECK(pooled.load(in) && pooled.size() == big.size() && pooled.back() == big.back());
+  }
+  round_trip(List_<Point>{{1, 2, 0.5}, {-3, 4, 1e300}});
+  round_trip(List_<std::string>{"", "a", std::string(200'000, 'x'), "tail"});
+  round_trip(List_<std::u32string>{U"wide", U""});
+  //
+  truncated(List_<int>{1, 2, 3});
+  truncated(List_<std::string>{"ab", "", "cde"});
+  corrupted_header();
+  absurd_sizes();
+  return check::result();
+}
@@ -0,0 +1,164 @@
+/**
+* @file simd.cpp
+* @brief the `simd::` kernels and the `Unrolled_list_` scans built on them against the scalar
+*   `<algorithm>` results for `int`, `std::int64_t`, `float` and `double`, on every length up to
+*   a few vectors and at unaligned starts so each main loop and tail runs, with NaNs in min / max,
+*   once per dispatch level forced with `simd::limit` ( levels the CPU lacks fall back lower )
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include "check.hpp"
+#include "simd.hpp"
+#include "unrolled_list.hpp"
+
+
+namespace {
+
+/// @brief equal, or both NaN
+template <typename T>
+auto same(const T a, const T b)
+    -> bool
+{
+  if constexpr ( std::is_floating_point_v<T> ) {
+    if ( std::isnan(a) || std::isnan(b) ) { return std::isnan(a) && std::isnan(b); }
+  }
+  return a == b;
+}
+
+/// @brief left fold with `pick`, like `simd::min` / `simd::max` a NaN anywhere gives NaN
+template <typename T, typename Pick>
+auto scalar(const std::vector<T>& v, T acc, Pick pick)
+    -> T
+{
+  for (const T x : v) {
+    if ( x != x || acc != acc ) { return std::numeric_limits<T>::quiet_NaN(); }
+    acc = pick(acc, x);
+  }
+  return acc;
+}
+
+constexpr auto smaller = [](const auto a, const auto b) { return std::min(a, b); };
+constexpr auto larger  = [](const auto a, const auto b) { return std::max(a, b); };
+
+/// @brief whole numbers, small enough that float sums are exact in any order
+template <typename T>
+auto values(const std::size_t n, std::mt19937& rng)
+    -> std::vector<T>
+{
+  std::vector<T> v(n);
+  for (T& x : v) { x = static_cast<T>(static_cast<int>(rng() % 201) - 100); }
+  return v;
+}
+
+/// @brief find / count / min / max / sum on `v`, copied to an odd offset so loads are unaligned
+template <typename T>
+auto kernels(const std::vector<T>& v, const std::size_t offset)
+    -> bool
+{
+  std::vector<T> buffer(offset, T{});
+  buffer.insert(buffer.end(), v.begin(), v.end());
+  const T *first = buffer.data() + offset;
+  const T *last  = first + v.size();
+  bool ok = true;
+  for (const T target : {T{7}, T{-100}, T{1000}}) {
+    ok = ok && simd::find(first, last, target) - first == std::find(v.begin(), v.end(), target) - v.begin();
+    ok = ok && simd::count(first, last, target) == static_cast<std::size_t>(std::count(v.begin(), v.end(), target));
+  }
+  ok = ok && same(simd::min(first, last, T{50}), scalar(v, T{50}, smaller));
+  ok = ok && same(simd::max(first, last, T{-50}), scalar(v, T{-50}, larger));
+  if constexpr ( std::is_floating_point_v<T> ) {
+    ok = ok && same(simd::sum(first, last, T{3}), std::accumulate(v.begin(), v.end(), T{3}));
+  } else { // wraps like the unsigned type
+    using U = std::make_unsigned_t<T>;
+    U expected = 3;
+    for (const T x : v) { expected = static_cast<U>(expected + static_cast<U>(x)); }
+    ok = ok && simd::sum(first, last, T{3}) == static_cast<T>(expected);
+  }
+  return ok;
+}
+
+/// @brief the same scans through an `Unrolled_list_` whose chunks are left partly filled
+template <typename T, std::size_t K>
+auto unrolled(std::vector<T> v, std::mt19937& rng)
+    -> bool
+{
+  Unrolled_list_<T, K> list;
+  for (const T x : v) { list.push_back(x); }
+  for (std::size_t k = v.size() / 4; k != 0; --k) { // holes in the middle of chunks
+    const std::size_t pos = rng() % v.size();
+    list.pop_at(pos);
+    v.erase(v.begin() + static_cast<std::ptrdiff_t>(pos));
+  }
+  if ( v.empty() ) { return list.is_empty(); }
+  bool ok = list.size() == v.size();
+  for (const T target : {v[v.size() / 2], v.back(), T{1000}}) {
+    const auto at = std::find(v.begin(), v.end(), target);
+    ok = ok && list.locate(target) == ( at == v.end() ? -1 : at - v.begin() );
+    ok = ok && list.search(target) == ( at != v.end() );
+    ok = ok && list.count(target) == static_cast<std::size_t>(std::count(v.begin(), v.end(), target));
+  }
+  ok = ok && same(list.min(), scalar(v, v.front(), smaller));
+  ok = ok && same(list.max(), scalar(v, v.front(), larger));
+  if constexpr ( std::is_floating_point_v<T> ) { ok = ok && same(list.sum(), std::accumulate(v.begin(), v.end(), T{})); }
+  else                                         { ok = ok && list.sum() == simd::sum(v.data(), v.data() + v.size(), T{}); }
+  return ok;
+}
+
+template <typename T>
+auto run(const char *type)
+    -> void
+{
+  std::mt19937 rng(sizeof(T));
+  // every length through two AVX2 vectors of bytes, a long one, each at three alignments
+  std::vector<std::size_t> lengths(80);
+  std::iota(lengths.begin(), lengths.end(), 0);
+  lengths.push_back(1000);
+  lengths.push_back(1001);
+  for (const std::size_t n : lengths) {
+    const std::vector<T> v = values<T>(n, rng);
+    for (const std::size_t offset : {0u, 1u, 3u}) {
+      if ( !CHECK(kernels(v, offset)) ) { std::fprintf(stderr, "  %s, %zu elements at offset %zu\n", type, n, offset); return; }
+    }
+    if ( !CHECK((unrolled<T, 5>(v, rng) && unrolled<T, 64>(v, rng))) ) { std::fprintf(stderr, "  Unrolled_list_<%s>, %zu elements\n", type, n); return; }
+  }
+  if constexpr ( std::is_floating_point_v<T> ) { // a NaN anywhere, the first lane and the tail included
+    for (const std::size_t n : {1u, 9u, 33u, 100u}) {
+      for (std::size_t at = 0; at < n; ++at) {
+        std::vector<T> v = values<T>(n, rng);
+        v[at] = std::numeric_limits<T>::quiet_NaN();
+        const bool ok = same(simd::min(v.data(), v.data() + n, T{0}), v[at])
+                     && same(simd::max(v.data(), v.data() + n, T{0}), v[at])
+                     && simd::find(v.data(), v.data() + n, v[at]) == v.data() + n // NaN equals nothing
+                     && simd::count(v.data(), v.data() + n, v[at]) == 0
+                     && unrolled<T, 4>(v, rng);
+        if ( !CHECK(ok) ) { std::fprintf(stderr, "  %s, NaN at %zu of %zu\n", type, at, n); return; }
+      }
+    }
+    const std::vector<T> v = values<T>(50, rng); // a NaN start
+    CHECK(std::isnan(simd::min(v.data(), v.data() + v.size(), std::numeric_limits<T>::quiet_NaN())));
+  }
+}
+
+} // namespace
+
+auto main()
+    -> int
+{
+  for (const simd::Level level : {simd::Level::scalar, simd::Level::sse2, simd::Level::avx2}) {
+    simd::limit(level);
+    if ( simd::level != level ) { std::printf("level %d not supported, running %d\n", static_cast<int>(level), static_cast<int>(simd::level.load())); }
+    run<int>("int");
+    run<std::int64_t>("std::int64_t");
+    run<float>("float");
+    run<double>("double");
+  }
+  return check::result();
+}
@@ -0,0 +1,84 @@
+/**
+* @file stats.cpp
+* @brief `stats::Count` on a known sequence of operations: exact allocations, frees, walked
+*   nodes and calls per operation, forwarding operations counting for both, process totals
+*   summing two lists and going back to nothing in use once both are gone; `stats::None`
+*   must not make `List_` any bigger
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include "check.hpp"
+#include "list.hpp"
+#include "stats.hpp"
+
+
+namespace {
+
+using Counted = List_<int, std::allocator<int>, policy::Apologize, stats::Count>;
+using stats::Op;
+
+// head, tail, size and the cursor with its position, nothing for the allocator or `stats::None`
+static_assert(sizeof(List_<int, std::allocator<int>, policy::Unchecked, stats::None>) == 3 * sizeof(void *) + 2 * sizeof(std::size_t));
+static_assert(sizeof(Counted) > sizeof(List_<int>));
+
+/// @brief calls per operation, every other operation must be 0
+auto calls_are(const stats::Counters& c, const std::initializer_list<std::pair<Op, std::uint64_t>> expected)
+    -> bool
+{
+  stats::Counters want;
+  for (const auto& [op, n] : expected) { want.m_calls[static_cast<std::size_t>(op)] = n; }
+  return c.m_calls == want.m_calls;
+}
+
+} // namespace
+
+auto main()
+    -> int
+{
+  CHECK(stats::process().m_allocations == 0 && stats::process().m_bytes_in_use == 0);
+  {
+    Counted a;
+    a.push_back(1);
+    a.push_back(2);
+    a.push_back(3);
+    a.push_front(0);        // 0 1 2 3
+    a.push_at(2, 9);        // 0 1 9 2 3, one step back from the tail, the cursor stays on 2
+    a.push_at(0, -1);       // forwards to push_front, -1 0 1 9 2 3
+    a.push_at(5, 7);        // the last position forwards to push_back, -1 0 1 9 2 3 7
+    CHECK(a.at(3) == 9);    // one step back from the cursor on 2
+    CHECK(std::as_const(a).at(6) == 7); // the tail itself
+    a.pop_at(1);            // one step from the head, -1 1 9 2 3 7
+    CHECK(a.locate(9) == 2);  // 3 nodes
+    CHECK(a.search(3));       // 5 nodes
+    CHECK(!a.search(100));    // all 6
+    //
+    Counted b;
+    b.push_back(10);
+    b.push_back(11);
+    a.splice(a.cend(), b);  // walks nothing, the nodes and their bytes move to `a`
+    //
+    const stats::Counters ca = a.counters();
+    const stats::Counters cb = b.counters();
+    CHECK(ca.m_allocations == 7 && ca.m_frees == 1);
+    CHECK(ca.m_nodes_walked == 1 + 1 + 0 + 1 + 3 + 5 + 6);
+    CHECK(calls_are(ca, {{Op::push_back, 4}, {Op::push_front, 2}, {Op::push_at, 3}, {Op::at, 2},
+                         {Op::pop_at, 1}, {Op::locate, 1}, {Op::search, 2}, {Op::splice, 1}}));
+    CHECK(cb.m_allocations == 2 && cb.m_frees == 0 && cb.m_nodes_walked == 0);
+    CHECK(calls_are(cb, {{Op::push_back, 2}}));
+    //
+    const stats::Counters total = stats::process();
+    CHECK(total.m_allocations == ca.m_allocations + cb.m_allocations);
+    CHECK(total.m_frees == ca.m_frees + cb.m_frees);
+    CHECK(total.m_nodes_walked == ca.m_nodes_walked + cb.m_nodes_walked);
+    for (std::size_t i = 0; i < stats::op_count; ++i) { CHECK(total.m_calls[i] == ca.m_calls[i] + cb.m_calls[i]); }
+    CHECK(ca.m_bytes_in_use != 0 && cb.m_bytes_in_use == 0);
+    CHECK(total.m_bytes_in_use == ca.m_bytes_in_use && ca.m_bytes_in_use % a.size() == 0);
+  }
+  const stats::Counters after = stats::process();
+  CHECK(after.m_bytes_in_use == 0 && after.m_frees == after.m_allocations && after.m_allocations == 9);
+  return check::result();
+}